@@ -683,6 +683,246 @@ set(SIMDPP_X86_AVX512VL_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "-mavx512vbmi")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI")
+set(SIMDPP_X86_AVX512VBMI_SUFFIX "-x86_avx512vbmi")
+set(SIMDPP_X86_AVX512VBMI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_permutexvar_epi8(i, i); // only in AVX512-VBMI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI2_CXX_FLAGS "-mavx512vbmi2")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI2_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI2")
+set(SIMDPP_X86_AVX512VBMI2_SUFFIX "-x86_avx512vbmi2")
+set(SIMDPP_X86_AVX512VBMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_shldv_epi16(i, i, i); // only in AVX512-VBMI2
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512vnni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_avx512vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_dpbusd_epi32(i, i, i); // only in AVX512-VNNI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BITALG")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512BITALG_CXX_FLAGS "-mavx512bitalg")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512BITALG_DEFINE "SIMDPP_ARCH_X86_AVX512BITALG")
+set(SIMDPP_X86_AVX512BITALG_SUFFIX "-x86_avx512bitalg")
+set(SIMDPP_X86_AVX512BITALG_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_popcnt_epi8(i); // only in AVX512-BITALG
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VPOPCNTDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "-mavx512vpopcntdq")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VPOPCNTDQ_DEFINE "SIMDPP_ARCH_X86_AVX512VPOPCNTDQ")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_SUFFIX "-x86_avx512vpopcntdq")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_popcnt_epi32(i); // only in AVX512-VPOPCNTDQ
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512CD")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512CD_CXX_FLAGS "-mavx512cd")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512CD_DEFINE "SIMDPP_ARCH_X86_AVX512CD")
+set(SIMDPP_X86_AVX512CD_SUFFIX "-x86_avx512cd")
+set(SIMDPP_X86_AVX512CD_TEST_CODE
+    "#include <immintrin.h>
+    #include <cstdio>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::printf(\"%c\", *ptr);
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_lzcnt_epi32(i); // only in AVX512-CD
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -1034,7 +1274,9 @@ endfunction()
 #   The following identifiers are currently supported:
 #   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
 #   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
-#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_XOP,
+#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_AVX512VBMI,
+#   X86_AVX512VBMI2, X86_AVX512VNNI, X86_AVX512BITALG, X86_AVX512VPOPCNTDQ,
+#   X86_AVX512CD, X86_XOP,
 #   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
@@ -1188,6 +1430,20 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
                     # All Intel processors that support AVX512BW also support
                     # AVX512DQ and AVX512VL
                     list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512CD)
+                        # Since Skylake-X and Zen 4
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512CD")
+                    endif()
+
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512VBMI AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VBMI2 AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VNNI AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512BITALG AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VPOPCNTDQ)
+                        # Since Ice Lake and Zen 4
+                        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512VBMI,X86_AVX512VBMI2,X86_AVX512VNNI,X86_AVX512BITALG,X86_AVX512VPOPCNTDQ")
+                    endif()
                 endif()
             endif()
         endif()
@@ -124,6 +124,16 @@ SIMDPP_INL T reverse_8lane_bottom4(const any_vec32<N,T>& a)
     return shuffle1_128<0, 1>(reversed, aw);
 }
 
+template<unsigned N, class T>
+SIMDPP_INL T reverse_8lane(const any_vec32<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T reversed = permute4<3, 2, 1, 0>(aw);
+
+    return shuffle1_128<1, 0>(reversed, reversed);
+}
+
 template<unsigned N, class T>
 SIMDPP_INL T sort_8lane_4el_asc_4el_dec(const any_vec32<N,T>& a)
 {
@@ -168,6 +178,165 @@ SIMDPP_INL T bitonic_sort_8lane_finalize_dec(const any_vec32<N, T>& a)
     return sort_4lane_2el_dec_2el_dec(step2_res);
 }
 
+// The networks below operate on 64-bit elements
+
+// The type of the vector containing the lower or upper half of elements of T
+template<class T> struct bitonic_half_vec;
+template<unsigned N> struct bitonic_half_vec<int64<N>> { using type = int64<N/2>; };
+template<unsigned N> struct bitonic_half_vec<uint64<N>> { using type = uint64<N/2>; };
+template<unsigned N> struct bitonic_half_vec<float64<N>> { using type = float64<N/2>; };
+
+template<unsigned N, class T>
+SIMDPP_INL T sort_2lane_asc(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T swapped = permute2<1, 0>(aw);
+
+    T res_min = min(aw, swapped);
+    T res_max = max(aw, swapped);
+
+    return zip2_lo(res_min, res_max);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T sort_2lane_dec(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T swapped = permute2<1, 0>(aw);
+
+    T res_max = max(aw, swapped);
+    T res_min = min(aw, swapped);
+
+    return zip2_lo(res_max, res_min);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T sort_4lane_2el_asc_2el_dec(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T swapped = permute2<1, 0>(aw);
+
+    T res_min = min(aw, swapped);
+    T res_max = max(aw, swapped);
+
+    T res_asc = zip2_lo(res_min, res_max);
+    T res_dec = zip2_lo(res_max, res_min);
+    return shuffle1_128<0, 1>(res_asc, res_dec);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T sort_4lane_corresponding_2el_asc(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+    T swapped = shuffle1_128<1, 0>(aw, aw);
+
+    T res_min = min(aw, swapped);
+    T res_max = max(aw, swapped);
+
+    return shuffle1_128<0, 1>(res_min, res_max);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T sort_4lane_corresponding_2el_dec(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+    T swapped = shuffle1_128<1, 0>(aw, aw);
+
+    T res_max = max(aw, swapped);
+    T res_min = min(aw, swapped);
+
+    return shuffle1_128<0, 1>(res_max, res_min);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T reverse_4lane(const any_vec64<N,T>& a)
+{
+    return permute4<3, 2, 1, 0>(a.wrapped());
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T bitonic_sort_4lane_finalize_asc(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T step1_res = sort_4lane_corresponding_2el_asc(aw);
+    return sort_2lane_asc(step1_res);
+}
+
+template<unsigned N, class T>
+SIMDPP_INL T bitonic_sort_4lane_finalize_dec(const any_vec64<N,T>& a)
+{
+    auto& aw = a.wrapped();
+
+    T step1_res = sort_4lane_corresponding_2el_dec(aw);
+    return sort_2lane_dec(step1_res);
+}
+
+/*  The 8-lane 64-bit networks operate on the halves of the vector separately
+    so that no permutes crossing 256-bit boundary are needed.
+*/
+template<class T>
+SIMDPP_INL T sort_8lane_4el_asc_4el_dec(const any_vec64<8,T>& a)
+{
+    typename bitonic_half_vec<T>::type lo, hi;
+    split(a.wrapped(), lo, hi);
+
+    lo = bitonic_sort_4lane_finalize_asc(sort_4lane_2el_asc_2el_dec(lo));
+    hi = bitonic_sort_4lane_finalize_dec(sort_4lane_2el_asc_2el_dec(hi));
+    return combine(lo, hi);
+}
+
+template<class T>
+SIMDPP_INL T sort_8lane_4el_dec_4el_asc(const any_vec64<8,T>& a)
+{
+    typename bitonic_half_vec<T>::type lo, hi;
+    split(a.wrapped(), lo, hi);
+
+    lo = bitonic_sort_4lane_finalize_dec(sort_4lane_2el_asc_2el_dec(lo));
+    hi = bitonic_sort_4lane_finalize_asc(sort_4lane_2el_asc_2el_dec(hi));
+    return combine(lo, hi);
+}
+
+template<class T>
+SIMDPP_INL T reverse_8lane(const any_vec64<8,T>& a)
+{
+    typename bitonic_half_vec<T>::type lo, hi;
+    split(a.wrapped(), lo, hi);
+
+    return combine(reverse_4lane(hi), reverse_4lane(lo));
+}
+
+template<class T>
+SIMDPP_INL T bitonic_sort_8lane_finalize_asc(const any_vec64<8,T>& a)
+{
+    using H = typename bitonic_half_vec<T>::type;
+    H lo, hi;
+    split(a.wrapped(), lo, hi);
+
+    H res_min = min(lo, hi);
+    H res_max = max(lo, hi);
+
+    return combine(bitonic_sort_4lane_finalize_asc(res_min),
+                   bitonic_sort_4lane_finalize_asc(res_max));
+}
+
+template<class T>
+SIMDPP_INL T bitonic_sort_8lane_finalize_dec(const any_vec64<8,T>& a)
+{
+    using H = typename bitonic_half_vec<T>::type;
+    H lo, hi;
+    split(a.wrapped(), lo, hi);
+
+    H res_max = max(lo, hi);
+    H res_min = min(lo, hi);
+
+    return combine(bitonic_sort_4lane_finalize_dec(res_max),
+                   bitonic_sort_4lane_finalize_dec(res_min));
+}
+
 } // namespace detail
 
 /** Sorts data in the given SIMD registers in increasing order. Sort is not stable.
@@ -225,6 +394,151 @@ void bitonic_sort_dec(any_vec32<8,T>& a0, any_vec32<8,T>& a1)
     a1.wrapped() = r1;
 }
 
+/** Merges two sorted SIMD registers. On entry the data in both @a a0 and @a a1
+    must be sorted in increasing order. On exit @a a0 contains the lower half
+    and @a a1 contains the upper half of the merged data, both in increasing
+    order.
+*/
+template<class T>
+void bitonic_merge_asc(any_vec32<8,T>& a0, any_vec32<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = detail::reverse_8lane(a1.wrapped());
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_min);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_max);
+}
+
+/** Merges two sorted SIMD registers. On entry the data in both @a a0 and @a a1
+    must be sorted in decreasing order. On exit @a a0 contains the upper half
+    and @a a1 contains the lower half of the merged data, both in decreasing
+    order.
+*/
+template<class T>
+void bitonic_merge_dec(any_vec32<8,T>& a0, any_vec32<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = detail::reverse_8lane(a1.wrapped());
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_max);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_min);
+}
+
+/** Sorts 64-bit data in the given SIMD registers in increasing order. Sort is
+    not stable. Versions for 2, 4 and 8 elements per register are provided.
+
+    On targets without native 64-bit integer min and max (e.g. SSE2-SSE4.1)
+    these operations are emulated using 32-bit comparisons.
+*/
+template<class T>
+void bitonic_sort_asc(any_vec64<2,T>& a0)
+{
+    a0.wrapped() = detail::sort_2lane_asc(a0.wrapped());
+}
+
+template<class T>
+void bitonic_sort_dec(any_vec64<2,T>& a0)
+{
+    a0.wrapped() = detail::sort_2lane_dec(a0.wrapped());
+}
+
+template<class T>
+void bitonic_sort_asc(any_vec64<4,T>& a0)
+{
+    auto r = detail::sort_4lane_2el_asc_2el_dec(a0.wrapped());
+    a0.wrapped() = detail::bitonic_sort_4lane_finalize_asc(r);
+}
+
+template<class T>
+void bitonic_sort_dec(any_vec64<4,T>& a0)
+{
+    auto r = detail::sort_4lane_2el_asc_2el_dec(a0.wrapped());
+    a0.wrapped() = detail::bitonic_sort_4lane_finalize_dec(r);
+}
+
+template<class T>
+void bitonic_sort_asc(any_vec64<8,T>& a0)
+{
+    auto r = detail::sort_8lane_4el_asc_4el_dec(a0.wrapped());
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_asc(r);
+}
+
+template<class T>
+void bitonic_sort_dec(any_vec64<8,T>& a0)
+{
+    auto r = detail::sort_8lane_4el_dec_4el_asc(a0.wrapped());
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_dec(r);
+}
+
+template<class T>
+void bitonic_sort_asc(any_vec64<8,T>& a0, any_vec64<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = a1.wrapped();
+    r0 = detail::sort_8lane_4el_asc_4el_dec(r0);
+    r0 = detail::bitonic_sort_8lane_finalize_asc(r0);
+    r1 = detail::sort_8lane_4el_asc_4el_dec(r1);
+    r1 = detail::bitonic_sort_8lane_finalize_dec(r1);
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_min);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_max);
+}
+
+template<class T>
+void bitonic_sort_dec(any_vec64<8,T>& a0, any_vec64<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = a1.wrapped();
+    r0 = detail::sort_8lane_4el_dec_4el_asc(r0);
+    r0 = detail::bitonic_sort_8lane_finalize_dec(r0);
+    r1 = detail::sort_8lane_4el_dec_4el_asc(r1);
+    r1 = detail::bitonic_sort_8lane_finalize_asc(r1);
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_max);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_min);
+}
+
+/** Merges two sorted SIMD registers containing 8 64-bit elements each. See
+    the 32-bit version for the description.
+*/
+template<class T>
+void bitonic_merge_asc(any_vec64<8,T>& a0, any_vec64<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = detail::reverse_8lane(a1.wrapped());
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_min);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_asc(res_max);
+}
+
+template<class T>
+void bitonic_merge_dec(any_vec64<8,T>& a0, any_vec64<8,T>& a1)
+{
+    auto r0 = a0.wrapped();
+    auto r1 = detail::reverse_8lane(a1.wrapped());
+
+    T res_max = max(r0, r1);
+    T res_min = min(r0, r1);
+
+    a0.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_max);
+    a1.wrapped() = detail::bitonic_sort_8lane_finalize_dec(res_min);
+}
+
 } // namespace simdpp
 } // namespace SIMDPP_ARCH_NAMESPACE
 
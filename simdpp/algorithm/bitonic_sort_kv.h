@@ -0,0 +1,265 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_BITONIC_SORT_KV_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_BITONIC_SORT_KV_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/bitonic_sort.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+/*  Completes a compare-exchange step of a sorting network on key/value pairs.
+    @a k_new contains either the own key or the key of the partner lane for
+    each lane. Lanes whose key changes take both the key and the value from
+    the partner lane. Lanes with equal keys keep their own values, so no value
+    is ever duplicated or lost.
+*/
+template<class K, class V>
+SIMDPP_INL void kv_exchange(K& k, V& v, const K& k_partner, const V& v_partner,
+                            const K& k_new)
+{
+    auto take_partner = cmp_neq(k_new, k);
+    k = blend(k_partner, k, take_partner);
+    v = blend(v_partner, v, take_partner);
+}
+
+// Moves the smaller keys to k0 and the larger keys to k1 along with the values
+template<class K, class V>
+SIMDPP_INL void kv_exchange_regs(K& k0, K& k1, V& v0, V& v1)
+{
+    auto swap_mask = cmp_lt(k1, k0);
+
+    K k0_new = blend(k1, k0, swap_mask);
+    k1 = blend(k0, k1, swap_mask);
+    k0 = k0_new;
+
+    V v0_new = blend(v1, v0, swap_mask);
+    v1 = blend(v0, v1, swap_mask);
+    v0 = v0_new;
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_4lane_2el_asc_2el_dec(K& k, V& v)
+{
+    K k_partner = permute4<1, 0, 3, 2>(k);
+    V v_partner = permute4<1, 0, 3, 2>(v);
+    kv_exchange(k, v, k_partner, v_partner, sort_4lane_2el_asc_2el_dec(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_4lane_2el_asc_2el_asc(K& k, V& v)
+{
+    K k_partner = permute4<1, 0, 3, 2>(k);
+    V v_partner = permute4<1, 0, 3, 2>(v);
+    kv_exchange(k, v, k_partner, v_partner, sort_4lane_2el_asc_2el_asc(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_4lane_2el_dec_2el_dec(K& k, V& v)
+{
+    K k_partner = permute4<1, 0, 3, 2>(k);
+    V v_partner = permute4<1, 0, 3, 2>(v);
+    kv_exchange(k, v, k_partner, v_partner, sort_4lane_2el_dec_2el_dec(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_4lane_corresponding_2el_asc(K& k, V& v)
+{
+    K k_partner = permute4<2, 3, 0, 1>(k);
+    V v_partner = permute4<2, 3, 0, 1>(v);
+    kv_exchange(k, v, k_partner, v_partner, sort_4lane_corresponding_2el_asc(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_4lane_corresponding_2el_dec(K& k, V& v)
+{
+    K k_partner = permute4<2, 3, 0, 1>(k);
+    V v_partner = permute4<2, 3, 0, 1>(v);
+    kv_exchange(k, v, k_partner, v_partner, sort_4lane_corresponding_2el_dec(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_8lane_corresponding_4el_asc(K& k, V& v)
+{
+    K k_partner = shuffle1_128<1, 0>(k, k);
+    V v_partner = shuffle1_128<1, 0>(v, v);
+    kv_exchange(k, v, k_partner, v_partner, sort_8lane_corresponding_4el_asc(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_8lane_corresponding_4el_dec(K& k, V& v)
+{
+    K k_partner = shuffle1_128<1, 0>(k, k);
+    V v_partner = shuffle1_128<1, 0>(v, v);
+    kv_exchange(k, v, k_partner, v_partner, sort_8lane_corresponding_4el_dec(k));
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_8lane_4el_asc_4el_dec(K& k, V& v)
+{
+    kv_sort_4lane_2el_asc_2el_dec(k, v);
+    kv_sort_4lane_corresponding_2el_asc(k, v);
+    kv_sort_4lane_2el_asc_2el_asc(k, v);
+    k = reverse_8lane_top4(k);
+    v = reverse_8lane_top4(v);
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_sort_8lane_4el_dec_4el_asc(K& k, V& v)
+{
+    kv_sort_4lane_2el_asc_2el_dec(k, v);
+    kv_sort_4lane_corresponding_2el_asc(k, v);
+    kv_sort_4lane_2el_asc_2el_asc(k, v);
+    k = reverse_8lane_bottom4(k);
+    v = reverse_8lane_bottom4(v);
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_bitonic_sort_8lane_finalize_asc(K& k, V& v)
+{
+    kv_sort_8lane_corresponding_4el_asc(k, v);
+    kv_sort_4lane_corresponding_2el_asc(k, v);
+    kv_sort_4lane_2el_asc_2el_asc(k, v);
+}
+
+template<class K, class V>
+SIMDPP_INL void kv_bitonic_sort_8lane_finalize_dec(K& k, V& v)
+{
+    kv_sort_8lane_corresponding_4el_dec(k, v);
+    kv_sort_4lane_corresponding_2el_dec(k, v);
+    kv_sort_4lane_2el_dec_2el_dec(k, v);
+}
+
+} // namespace detail
+
+/** Sorts key/value pairs in the given SIMD registers in increasing order of
+    the keys. Each value moves together with its key. Sort is not stable.
+*/
+template<class K, class V>
+void bitonic_sort_kv_asc(any_vec32<8,K>& k0, any_vec32<8,V>& v0)
+{
+    K k = k0.wrapped();
+    V v = v0.wrapped();
+    detail::kv_sort_8lane_4el_asc_4el_dec(k, v);
+    detail::kv_bitonic_sort_8lane_finalize_asc(k, v);
+    k0.wrapped() = k;
+    v0.wrapped() = v;
+}
+
+template<class K, class V>
+void bitonic_sort_kv_dec(any_vec32<8,K>& k0, any_vec32<8,V>& v0)
+{
+    K k = k0.wrapped();
+    V v = v0.wrapped();
+    detail::kv_sort_8lane_4el_dec_4el_asc(k, v);
+    detail::kv_bitonic_sort_8lane_finalize_dec(k, v);
+    k0.wrapped() = k;
+    v0.wrapped() = v;
+}
+
+template<class K, class V>
+void bitonic_sort_kv_asc(any_vec32<8,K>& k0, any_vec32<8,K>& k1,
+                         any_vec32<8,V>& v0, any_vec32<8,V>& v1)
+{
+    K rk0 = k0.wrapped();
+    K rk1 = k1.wrapped();
+    V rv0 = v0.wrapped();
+    V rv1 = v1.wrapped();
+    detail::kv_sort_8lane_4el_asc_4el_dec(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk0, rv0);
+    detail::kv_sort_8lane_4el_asc_4el_dec(rk1, rv1);
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk1, rv1);
+
+    detail::kv_exchange_regs(rk0, rk1, rv0, rv1);
+
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk1, rv1);
+    k0.wrapped() = rk0;
+    k1.wrapped() = rk1;
+    v0.wrapped() = rv0;
+    v1.wrapped() = rv1;
+}
+
+template<class K, class V>
+void bitonic_sort_kv_dec(any_vec32<8,K>& k0, any_vec32<8,K>& k1,
+                         any_vec32<8,V>& v0, any_vec32<8,V>& v1)
+{
+    K rk0 = k0.wrapped();
+    K rk1 = k1.wrapped();
+    V rv0 = v0.wrapped();
+    V rv1 = v1.wrapped();
+    detail::kv_sort_8lane_4el_dec_4el_asc(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk0, rv0);
+    detail::kv_sort_8lane_4el_dec_4el_asc(rk1, rv1);
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk1, rv1);
+
+    detail::kv_exchange_regs(rk1, rk0, rv1, rv0);
+
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk1, rv1);
+    k0.wrapped() = rk0;
+    k1.wrapped() = rk1;
+    v0.wrapped() = rv0;
+    v1.wrapped() = rv1;
+}
+
+/** Merges two sorted SIMD registers of key/value pairs. On entry the keys in
+    both @a k0 and @a k1 must be sorted in increasing order. On exit @a k0 and
+    @a v0 contain the lower half and @a k1 and @a v1 contain the upper half of
+    the merged data, both in increasing order of the keys.
+*/
+template<class K, class V>
+void bitonic_merge_kv_asc(any_vec32<8,K>& k0, any_vec32<8,K>& k1,
+                          any_vec32<8,V>& v0, any_vec32<8,V>& v1)
+{
+    K rk0 = k0.wrapped();
+    K rk1 = detail::reverse_8lane(k1.wrapped());
+    V rv0 = v0.wrapped();
+    V rv1 = detail::reverse_8lane(v1.wrapped());
+
+    detail::kv_exchange_regs(rk0, rk1, rv0, rv1);
+
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_asc(rk1, rv1);
+    k0.wrapped() = rk0;
+    k1.wrapped() = rk1;
+    v0.wrapped() = rv0;
+    v1.wrapped() = rv1;
+}
+
+/** Merges two sorted SIMD registers of key/value pairs. On entry the keys in
+    both @a k0 and @a k1 must be sorted in decreasing order. On exit @a k0 and
+    @a v0 contain the upper half and @a k1 and @a v1 contain the lower half of
+    the merged data, both in decreasing order of the keys.
+*/
+template<class K, class V>
+void bitonic_merge_kv_dec(any_vec32<8,K>& k0, any_vec32<8,K>& k1,
+                          any_vec32<8,V>& v0, any_vec32<8,V>& v1)
+{
+    K rk0 = k0.wrapped();
+    K rk1 = detail::reverse_8lane(k1.wrapped());
+    V rv0 = v0.wrapped();
+    V rv1 = detail::reverse_8lane(v1.wrapped());
+
+    detail::kv_exchange_regs(rk1, rk0, rv1, rv0);
+
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk0, rv0);
+    detail::kv_bitonic_sort_8lane_finalize_dec(rk1, rv1);
+    k0.wrapped() = rk0;
+    k1.wrapped() = rk1;
+    v0.wrapped() = rv0;
+    v1.wrapped() = rv1;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_BITONIC_SORT_KV_H
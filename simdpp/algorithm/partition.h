@@ -0,0 +1,458 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_PARTITION_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_PARTITION_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/sort.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+/*  The vector and mask types that are used to partition elements of type
+    @a T. The widest vectors that are fast on the current architecture are
+    used.
+*/
+template<class T> struct partition_traits;
+
+template<> struct partition_traits<std::int32_t> {
+    using vec = int32<SIMDPP_FAST_INT32_SIZE>;
+    using mask = mask_int32<SIMDPP_FAST_INT32_SIZE>;
+};
+template<> struct partition_traits<std::uint32_t> {
+    using vec = uint32<SIMDPP_FAST_INT32_SIZE>;
+    using mask = mask_int32<SIMDPP_FAST_INT32_SIZE>;
+};
+template<> struct partition_traits<float> {
+    using vec = float32<SIMDPP_FAST_INT32_SIZE>;
+    using mask = mask_float32<SIMDPP_FAST_INT32_SIZE>;
+};
+template<> struct partition_traits<std::int64_t> {
+    using vec = int64<SIMDPP_FAST_INT64_SIZE>;
+    using mask = mask_int64<SIMDPP_FAST_INT64_SIZE>;
+};
+template<> struct partition_traits<std::uint64_t> {
+    using vec = uint64<SIMDPP_FAST_INT64_SIZE>;
+    using mask = mask_int64<SIMDPP_FAST_INT64_SIZE>;
+};
+template<> struct partition_traits<double> {
+    using vec = float64<SIMDPP_FAST_INT64_SIZE>;
+    using mask = mask_float64<SIMDPP_FAST_INT64_SIZE>;
+};
+
+/*  For each combination of selected lanes of a vector of @a L elements of
+    @a E bytes each, contains the permutation that moves the selected lanes
+    to the beginning of the vector and the remaining lanes to the end. The
+    relative order of the lanes within each group is kept.
+*/
+template<unsigned L, unsigned E>
+struct partition_lut {
+    static const unsigned num_entries = 1 << L;
+
+    SIMDPP_ALIGN(16) std::uint8_t shuffle[num_entries][16];
+    std::uint8_t index[num_entries][L];
+    std::uint8_t count[num_entries];
+
+    static const partition_lut& get()
+    {
+        static const partition_lut lut;
+        return lut;
+    }
+
+private:
+    partition_lut()
+    {
+        for (unsigned m = 0; m < num_entries; ++m) {
+            unsigned pos = 0;
+            for (unsigned sel = 1; sel <= 2; ++sel) {
+                for (unsigned i = 0; i < L; ++i) {
+                    bool selected = (m & (1 << i)) != 0;
+                    if (selected != (sel == 1)) {
+                        continue;
+                    }
+                    index[m][pos] = i;
+                    for (unsigned b = 0; b < E; ++b) {
+                        shuffle[m][pos * E + b] = i * E + b;
+                    }
+                    pos++;
+                }
+                if (sel == 1) {
+                    count[m] = pos;
+                }
+            }
+        }
+    }
+};
+
+/*  Moves the lanes of @a a selected by the bits in @a bits to the beginning
+    of the vector and the other lanes to the end.
+*/
+template<class V, class Lut>
+SIMDPP_INL V partition_lanes(const V& a, unsigned bits, const Lut& lut)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(16) E in[V::length];
+    SIMDPP_ALIGN(16) E out[V::length];
+    store(in, a);
+    for (unsigned i = 0; i < V::length; ++i) {
+        out[i] = in[lut.index[bits][i]];
+    }
+    return load(out);
+#else
+    uint8<16> idx = load(lut.shuffle[bits]);
+    uint8<16> r = permute_bytes16(bit_cast<uint8<16>>(a), idx);
+    return bit_cast<V>(r);
+#endif
+}
+
+// The comparisons that may be used to select elements for the first group
+enum class partition_cmp {
+    lt, le, gt, ge
+};
+
+template<partition_cmp Cmp, class T>
+SIMDPP_INL bool partition_select(T x, T pivot)
+{
+    switch (Cmp) {
+    case partition_cmp::lt: return x < pivot;
+    case partition_cmp::le: return x <= pivot;
+    case partition_cmp::gt: return x > pivot;
+    case partition_cmp::ge: return x >= pivot;
+    }
+    return false;
+}
+
+template<partition_cmp Cmp, class M, class V>
+SIMDPP_INL M partition_select_mask(const V& a, const V& pivot)
+{
+    switch (Cmp) {
+    case partition_cmp::lt: return cmp_lt(a, pivot);
+    case partition_cmp::le: return cmp_le(a, pivot);
+    case partition_cmp::gt: return cmp_gt(a, pivot);
+    case partition_cmp::ge: return cmp_ge(a, pivot);
+    }
+    return M();
+}
+
+template<partition_cmp Cmp, class V>
+SIMDPP_INL unsigned partition_select_bits(const V& a, const V& pivot)
+{
+    switch (Cmp) {
+    case partition_cmp::lt: return extract_bits_any(cmp_lt(a, pivot));
+    case partition_cmp::le: return extract_bits_any(cmp_le(a, pivot));
+    case partition_cmp::gt: return extract_bits_any(cmp_gt(a, pivot));
+    case partition_cmp::ge: return extract_bits_any(cmp_ge(a, pivot));
+    }
+    return 0;
+}
+
+#if SIMDPP_USE_AVX512F
+/*  Partitions the vector @a a. The selected elements are written to
+    @a write_l which is advanced past them and the rest are written just
+    before @a write_r which is moved back before them. There must be space
+    for a whole vector at both sides.
+
+    The elements are packed using the compressing stores of AVX512F, which
+    write only the packed elements. This is required for the store to the
+    right side, as the memory after @a write_r already holds the elements of
+    the second group.
+*/
+template<partition_cmp Cmp, class T, class V>
+SIMDPP_INL void partition_vector(const V& a, const V& pivot, T*& write_l, T*& write_r)
+{
+    using M = typename partition_traits<T>::mask;
+    M mask = partition_select_mask<Cmp, M>(a, pivot);
+
+    unsigned count = store_compress(write_l, a, mask);
+    write_l += count;
+    write_r -= V::length - count;
+    store_compress(write_r, a, M(bit_not(mask)));
+}
+#else
+/*  Partitions the vector @a a. The selected elements are written to
+    @a write_l which is advanced past them and the rest are written just
+    before @a write_r which is moved back before them. Each side is written
+    using a full vector store, thus there must be space for a whole vector at
+    both sides.
+
+    The lanes are permuted using a lookup table which is indexed by the
+    comparison result of a 128-bit vector. Wider vectors are split and the
+    halves are partitioned one after another. Each half is written within the
+    space that the whole vector would occupy, thus the requirements on the
+    available space are the same.
+*/
+template<partition_cmp Cmp, class T, class V>
+SIMDPP_INL void partition_vector(const V& a, const V& pivot, T*& write_l, T*& write_r,
+                                 std::false_type /*is_wide*/)
+{
+    const auto& lut = partition_lut<V::length, sizeof(T)>::get();
+    unsigned bits = partition_select_bits<Cmp>(a, pivot);
+    V packed = partition_lanes(a, bits, lut);
+    unsigned count = lut.count[bits];
+
+    store_u(write_l, packed);
+    write_l += count;
+    store_u(write_r - V::length, packed);
+    write_r -= V::length - count;
+}
+
+template<partition_cmp Cmp, class T, template<unsigned> class V, unsigned N>
+SIMDPP_INL void partition_vector(const V<N>& a, const V<N>& pivot, T*& write_l, T*& write_r,
+                                 std::true_type /*is_wide*/);
+
+template<partition_cmp Cmp, class T, class V>
+SIMDPP_INL void partition_vector(const V& a, const V& pivot, T*& write_l, T*& write_r)
+{
+    using is_wide = std::integral_constant<bool, (V::length * sizeof(T) > 16)>;
+    partition_vector<Cmp>(a, pivot, write_l, write_r, is_wide());
+}
+
+template<partition_cmp Cmp, class T, template<unsigned> class V, unsigned N>
+SIMDPP_INL void partition_vector(const V<N>& a, const V<N>& pivot, T*& write_l, T*& write_r,
+                                 std::true_type /*is_wide*/)
+{
+    V<N/2> a_lo, a_hi, pivot_lo, pivot_hi;
+    split(a, a_lo, a_hi);
+    split(pivot, pivot_lo, pivot_hi);
+    partition_vector<Cmp>(a_lo, pivot_lo, write_l, write_r);
+    partition_vector<Cmp>(a_hi, pivot_hi, write_l, write_r);
+}
+#endif
+
+/*  Partitions the range [first, last) in place so that the elements for which
+    the comparison with @a pivot succeeds come first. Returns the end of the
+    first group.
+
+    The first and last vectors of the range are loaded up front, which leaves
+    space for a whole vector on both sides. Each subsequent vector is read
+    from the side that has less space left, thus there is always space to
+    write a whole vector to both sides. The selected elements of each vector
+    are written to the left side and the rest to the right side, see
+    partition_vector().
+*/
+template<partition_cmp Cmp, class T>
+T* partition_impl(T* first, T* last, T pivot)
+{
+    using V = typename partition_traits<T>::vec;
+    const unsigned L = V::length;
+
+    if (last - first < static_cast<std::ptrdiff_t>(2 * L)) {
+        return std::partition(first, last, [pivot](T x)
+                              { return partition_select<Cmp>(x, pivot); });
+    }
+
+    V pivot_v = splat(pivot);
+
+    T rest[3 * L];
+    V saved_l = load_u(first);
+    V saved_r = load_u(last - L);
+    store_u(rest, saved_l);
+    store_u(rest + L, saved_r);
+
+    T* read_l = first + L;
+    T* read_r = last - L;
+    T* write_l = first;
+    T* write_r = last;
+
+    while (read_r - read_l >= static_cast<std::ptrdiff_t>(L)) {
+        V v;
+        if (read_l - write_l <= write_r - read_r) {
+            v = load_u(read_l);
+            read_l += L;
+        } else {
+            read_r -= L;
+            v = load_u(read_r);
+        }
+        partition_vector<Cmp>(v, pivot_v, write_l, write_r);
+    }
+
+    // Fewer than L elements are left unread. They and the saved vectors are
+    // distributed one by one as the free space may be all on one side.
+    std::size_t rest_size = 2 * L + (read_r - read_l);
+    std::copy(read_l, read_r, rest + 2 * L);
+    for (std::size_t i = 0; i < rest_size; ++i) {
+        if (partition_select<Cmp>(rest[i], pivot)) {
+            *write_l++ = rest[i];
+        } else {
+            *--write_r = rest[i];
+        }
+    }
+    return write_l;
+}
+
+// Moves NaN values to the end of the range and returns the end of the rest
+template<class T>
+T* partition_nan_last(T* first, T* last)
+{
+    if (!std::numeric_limits<T>::has_quiet_NaN) {
+        return last;
+    }
+    return std::partition(first, last, [](T x) { return x == x; });
+}
+
+template<class T>
+T partition_median3(T a, T b, T c)
+{
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+/*  Rearranges [first, last) so that the element at @a nth is the one that
+    would be there if the range was sorted in increasing order (or decreasing
+    if @a Desc is true), the elements before it are not after it in that
+    order and the elements after it are not before it. The range must not
+    contain NaNs.
+
+    Uses quickselect with median-of-three pivots. The range is partitioned
+    into elements before the pivot and the rest. If the first group turns out
+    to be empty, then the rest is partitioned into the elements equal to the
+    pivot and the elements after it, which guarantees progress in the
+    presence of duplicates. If the search doesn't converge quickly,
+    std::nth_element is used for the remaining range.
+*/
+template<bool Desc, class T>
+void nth_element_impl(T* first, T* nth, T* last)
+{
+    const partition_cmp cmp_before = Desc ? partition_cmp::gt : partition_cmp::lt;
+    const partition_cmp cmp_not_after = Desc ? partition_cmp::ge : partition_cmp::le;
+    const std::ptrdiff_t small_size = 32;
+
+    unsigned depth_limit = 0;
+    for (std::size_t size = last - first; size > 0; size /= 2) {
+        depth_limit += 2;
+    }
+
+    while (last - first > small_size) {
+        if (depth_limit-- == 0) {
+            break;
+        }
+        T pivot = partition_median3(*first, first[(last - first) / 2], *(last - 1));
+
+        T* mid = partition_impl<cmp_before>(first, last, pivot);
+        if (nth < mid) {
+            last = mid;
+            continue;
+        }
+        if (mid == first) {
+            // all elements are equal to or after the pivot
+            mid = partition_impl<cmp_not_after>(first, last, pivot);
+            if (nth < mid) {
+                return;
+            }
+        }
+        first = mid;
+    }
+
+    if (Desc) {
+        std::nth_element(first, nth, last, std::greater<T>());
+    } else {
+        std::nth_element(first, nth, last);
+    }
+}
+
+} // namespace detail
+
+/** Partitions the range [first, last) so that the elements less than
+    @a pivot precede the other elements. Returns a pointer to the first
+    element of the second group. The relative order of the elements is not
+    preserved. NaN values are placed into the second group.
+
+    The elements are compared to the pivot a vector at a time, using the
+    widest vectors that are fast on the current architecture. On AVX512F the
+    elements of each group are written to the respective end of the range
+    using store_compress(). Elsewhere the result of the comparison is
+    converted to a bitmask using extract_bits_any() which selects a
+    permutation that packs the elements of the first group to the beginning
+    of a 128-bit vector and the permuted vector is stored to both ends of the
+    range. The partition is performed in place.
+
+    Supported element types are @c int32_t, @c uint32_t, @c float, @c int64_t,
+    @c uint64_t and @c double.
+
+    The function is compiled for the instruction set of the current
+    compilation unit. Use a dispatcher wrapper to select the best instruction
+    set at runtime, as described in sort().
+*/
+template<class T>
+T* partition(T* first, T* last, T pivot)
+{
+    return detail::partition_impl<detail::partition_cmp::lt>(first, last, pivot);
+}
+
+/** Rearranges the range [first, last) so that the element pointed to by
+    @a nth is the element that would be there if the range was sorted. All
+    elements before @a nth are less than or equal to it and all elements after
+    it are greater than or equal to it. NaN values are placed at the end of
+    the range as if they were larger than any other value.
+
+    Supported element types are the same as in partition().
+*/
+template<class T>
+void nth_element(T* first, T* nth, T* last)
+{
+    last = detail::partition_nan_last(first, last);
+    if (nth >= last) {
+        return;
+    }
+    detail::nth_element_impl<false>(first, nth, last);
+}
+
+/** Rearranges the range [first, last) so that the range [first, middle)
+    contains the smallest elements in increasing order. The order of the
+    remaining elements is unspecified. NaN values are placed at the end of the
+    range as if they were larger than any other value.
+
+    The smallest elements are selected using nth_element() and then sorted
+    using sort().
+
+    Supported element types are the same as in partition().
+*/
+template<class T>
+void partial_sort(T* first, T* middle, T* last)
+{
+    last = detail::partition_nan_last(first, last);
+    if (middle > last) {
+        middle = last;
+    }
+    if (middle < last) {
+        detail::nth_element_impl<false>(first, middle, last);
+    }
+    sort(first, middle);
+}
+
+/** Rearranges the range [first, last) so that its first @a k elements are
+    the @a k largest elements of the range in decreasing order. The order of
+    the remaining elements is unspecified. NaN values are placed at the end of
+    the range and are never selected.
+
+    Supported element types are the same as in partition().
+*/
+template<class T>
+void top_k(T* first, T* last, std::size_t k)
+{
+    last = detail::partition_nan_last(first, last);
+    T* middle = first + std::min<std::size_t>(k, last - first);
+    if (middle < last) {
+        detail::nth_element_impl<true>(first, middle, last);
+    }
+    sort(first, middle);
+    std::reverse(first, middle);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_PARTITION_H
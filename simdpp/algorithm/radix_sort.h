@@ -0,0 +1,501 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_RADIX_SORT_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_RADIX_SORT_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/bitonic_sort.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// Tuning parameters of radix_sort()
+struct radix_sort_options {
+    radix_sort_options() :
+        digit_bits(8),
+        non_temporal(false),
+        small_size(4096)
+    {}
+
+    /** The number of key bits that are sorted in a single pass. Must be in
+        range [1; 16]. Each pass uses a write-combining buffer of 64 bytes per
+        bucket, i.e. 16 KiB for the default of 8 bits. Larger values result in
+        fewer passes, but the buffers and the histograms must still fit into
+        L1 or L2 cache for the sort to be efficient.
+    */
+    unsigned digit_bits;
+
+    /** Whether to write full cache lines to the output buffer using
+        non-temporal stores (see stream()). This is beneficial if the data
+        doesn't fit into the last level cache.
+    */
+    bool non_temporal;
+
+    /** Arrays with fewer elements than this are sorted in place using a
+        bitonic sorting network.
+    */
+    std::size_t small_size;
+};
+
+namespace detail {
+
+// The size of a cache line and of the write-combining buffer of a bucket
+static const unsigned radix_sort_line_bytes = 64;
+
+// Keys that don't need conversion
+template<class K, class V>
+struct radix_sort_unsigned_key {
+    static V to_key(const V& a) { return a; }
+    static V from_key(const V& a) { return a; }
+    static K to_key(K a) { return a; }
+    static K from_key(K a) { return a; }
+};
+
+// Signed integers sort as unsigned integers once the sign bit is flipped
+template<class K, class V>
+struct radix_sort_signed_key {
+    static K sign() { return K(1) << (sizeof(K) * 8 - 1); }
+
+    static V to_key(const V& a) { return bit_xor(a, sign()); }
+    static V from_key(const V& a) { return bit_xor(a, sign()); }
+    static K to_key(K a) { return a ^ sign(); }
+    static K from_key(K a) { return a ^ sign(); }
+};
+
+/*  Floating-point values sort as unsigned integers once all bits of negative
+    values and the sign bit of the other values are flipped. The resulting
+    order is the totalOrder predicate of IEEE-754.
+*/
+template<class K, class V, class SV>
+struct radix_sort_float_key {
+    static K sign() { return K(1) << (sizeof(K) * 8 - 1); }
+
+    static V to_key(const V& a)
+    {
+        V neg_mask = shift_r<sizeof(K) * 8 - 1>(SV(a));
+        return bit_xor(a, bit_or(neg_mask, sign()));
+    }
+
+    static V from_key(const V& a)
+    {
+        V pos_mask = shift_r<sizeof(K) * 8 - 1>(SV(a));
+        return bit_xor(a, bit_or(bit_not(pos_mask), sign()));
+    }
+
+    static K to_key(K a) { return a ^ ((a & sign()) ? ~K(0) : sign()); }
+    static K from_key(K a) { return a ^ ((a & sign()) ? sign() : ~K(0)); }
+};
+
+/*  key: the unsigned integer type the data is sorted as
+    vec: the vector of key type spanning a cache line
+    small_vec: the vector of key type used by the bitonic network
+    conv: converts between the data and keys
+*/
+template<class T> struct radix_sort_traits;
+
+template<> struct radix_sort_traits<std::uint32_t> {
+    using key = std::uint32_t;
+    using vec = uint32<16>;
+    using small_vec = uint32<8>;
+    using conv = radix_sort_unsigned_key<key, vec>;
+};
+
+template<> struct radix_sort_traits<std::int32_t> {
+    using key = std::uint32_t;
+    using vec = uint32<16>;
+    using small_vec = uint32<8>;
+    using conv = radix_sort_signed_key<key, vec>;
+};
+
+template<> struct radix_sort_traits<float> {
+    using key = std::uint32_t;
+    using vec = uint32<16>;
+    using small_vec = uint32<8>;
+    using conv = radix_sort_float_key<key, vec, int32<16>>;
+};
+
+template<> struct radix_sort_traits<std::uint64_t> {
+    using key = std::uint64_t;
+    using vec = uint64<8>;
+    using small_vec = uint64<8>;
+    using conv = radix_sort_unsigned_key<key, vec>;
+};
+
+template<> struct radix_sort_traits<std::int64_t> {
+    using key = std::uint64_t;
+    using vec = uint64<8>;
+    using small_vec = uint64<8>;
+    using conv = radix_sort_signed_key<key, vec>;
+};
+
+template<> struct radix_sort_traits<double> {
+    using key = std::uint64_t;
+    using vec = uint64<8>;
+    using small_vec = uint64<8>;
+    using conv = radix_sort_float_key<key, vec, int64<8>>;
+};
+
+/*  Converts the data in @a data to keys in place and computes the histograms
+    of the digits for all passes. @a hist must contain @a num_passes zeroed
+    histograms of @a radix elements each.
+*/
+template<class T>
+void radix_sort_histogram(typename radix_sort_traits<T>::key* data, std::size_t size,
+                          unsigned digit_bits, unsigned num_passes, std::size_t* hist)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::vec;
+    using Conv = typename radix_sort_traits<T>::conv;
+    const unsigned L = V::length;
+    const K digit_mask = (K(1) << digit_bits) - 1;
+    const std::size_t radix = std::size_t(1) << digit_bits;
+
+    SIMDPP_ALIGN(64) K digits[L];
+
+    std::size_t i = 0;
+    for (; i + L <= size; i += L) {
+        V v = load_u(data + i);
+        v = Conv::to_key(v);
+        store_u(data + i, v);
+
+        for (unsigned p = 0; p < num_passes; ++p) {
+            V d = bit_and(shift_r(v, p * digit_bits), digit_mask);
+            store(digits, d);
+            std::size_t* h = hist + p * radix;
+            for (unsigned j = 0; j < L; ++j) {
+                h[digits[j]]++;
+            }
+        }
+    }
+    for (; i < size; ++i) {
+        K k;
+        std::memcpy(&k, data + i, sizeof(k));
+        k = Conv::to_key(k);
+        std::memcpy(data + i, &k, sizeof(k));
+
+        for (unsigned p = 0; p < num_passes; ++p) {
+            hist[p * radix + ((k >> (p * digit_bits)) & digit_mask)]++;
+        }
+    }
+}
+
+/*  Writes the elements of @a wc_line that belong to positions [from, to) of
+    @a dst. @a dst_misalign is the offset of @a dst in elements from the
+    preceding cache line boundary.
+*/
+template<class K>
+SIMDPP_INL void radix_sort_flush_partial(K* dst, const K* wc_line, std::size_t from,
+                                         std::size_t to, std::size_t dst_misalign,
+                                         unsigned L)
+{
+    if (from < to) {
+        std::memcpy(dst + from, wc_line + (from + dst_misalign) % L,
+                    (to - from) * sizeof(K));
+    }
+}
+
+/*  Distributes the keys in @a src to @a dst according to the digit at
+    @a shift. @a hist is the histogram of the digit.
+
+    The elements are first appended to a cache line sized write-combining
+    buffer of the bucket. The slots within the buffer correspond to the slots
+    within the destination cache line, thus full buffers are written out using
+    aligned vector stores that fill whole cache lines. Only the first and last
+    cache line of each bucket may be written partially.
+*/
+template<class T>
+void radix_sort_scatter(const typename radix_sort_traits<T>::key* src,
+                        typename radix_sort_traits<T>::key* dst, std::size_t size,
+                        unsigned shift, unsigned digit_bits, const std::size_t* hist,
+                        bool non_temporal,
+                        typename radix_sort_traits<T>::key* wc,
+                        std::size_t* begin, std::size_t* pos)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::vec;
+    const unsigned L = V::length;
+    const K digit_mask = (K(1) << digit_bits) - 1;
+    const std::size_t radix = std::size_t(1) << digit_bits;
+    const std::size_t dst_misalign =
+            (reinterpret_cast<std::uintptr_t>(dst) % radix_sort_line_bytes) / sizeof(K);
+
+    std::size_t sum = 0;
+    for (std::size_t b = 0; b < radix; ++b) {
+        begin[b] = sum;
+        pos[b] = sum;
+        sum += hist[b];
+    }
+
+    SIMDPP_ALIGN(64) K keys[L];
+    SIMDPP_ALIGN(64) K digits[L];
+
+    auto append = [&](K key, std::size_t b)
+    {
+        std::size_t q = pos[b]++;
+        unsigned slot = (q + dst_misalign) % L;
+        K* wc_line = wc + b * L;
+        wc_line[slot] = key;
+        if (slot != L - 1) {
+            return;
+        }
+        if (q + 1 >= begin[b] + L) {
+            V line = load(wc_line);
+            K* dst_line = dst + q + 1 - L;
+            if (non_temporal) {
+                stream(dst_line, line);
+            } else {
+                store(dst_line, line);
+            }
+        } else {
+            radix_sort_flush_partial(dst, wc_line, begin[b], q + 1, dst_misalign, L);
+        }
+    };
+
+    std::size_t i = 0;
+    for (; i + L <= size; i += L) {
+        V v = load_u(src + i);
+        V d = bit_and(shift_r(v, shift), digit_mask);
+        store(keys, v);
+        store(digits, d);
+        for (unsigned j = 0; j < L; ++j) {
+            append(keys[j], digits[j]);
+        }
+    }
+    for (; i < size; ++i) {
+        K k;
+        std::memcpy(&k, src + i, sizeof(k));
+        append(k, (k >> shift) & digit_mask);
+    }
+
+    for (std::size_t b = 0; b < radix; ++b) {
+        std::size_t line_size = (pos[b] + dst_misalign) % L;
+        std::size_t from = pos[b] - std::min(line_size, pos[b] - begin[b]);
+        radix_sort_flush_partial(dst, wc + b * L, from, pos[b], dst_misalign, L);
+    }
+
+#if SIMDPP_USE_SSE2
+    if (non_temporal) {
+        // make the non-temporal stores visible to other threads
+        _mm_sfence();
+    }
+#endif
+}
+
+// Converts keys back to data while copying from @a src to @a dst
+template<class T>
+void radix_sort_from_keys(const typename radix_sort_traits<T>::key* src,
+                          typename radix_sort_traits<T>::key* dst, std::size_t size)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::vec;
+    using Conv = typename radix_sort_traits<T>::conv;
+    const unsigned L = V::length;
+
+    std::size_t i = 0;
+    for (; i + L <= size; i += L) {
+        V v = load_u(src + i);
+        store_u(dst + i, Conv::from_key(v));
+    }
+    for (; i < size; ++i) {
+        K k;
+        std::memcpy(&k, src + i, sizeof(k));
+        k = Conv::from_key(k);
+        std::memcpy(dst + i, &k, sizeof(k));
+    }
+}
+
+// Converts the data in @a data to keys in place
+template<class T>
+void radix_sort_to_keys(typename radix_sort_traits<T>::key* data, std::size_t size)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::vec;
+    using Conv = typename radix_sort_traits<T>::conv;
+    const unsigned L = V::length;
+
+    std::size_t i = 0;
+    for (; i + L <= size; i += L) {
+        V v = load_u(data + i);
+        store_u(data + i, Conv::to_key(v));
+    }
+    for (; i < size; ++i) {
+        K k;
+        std::memcpy(&k, data + i, sizeof(k));
+        k = Conv::to_key(k);
+        std::memcpy(data + i, &k, sizeof(k));
+    }
+}
+
+template<class V>
+SIMDPP_INL void radix_sort_small_cmp(typename V::element_type* a,
+                                     typename V::element_type* b)
+{
+    V va = load_u(a);
+    V vb = load_u(b);
+    store_u(a, V(min(va, vb)));
+    store_u(b, V(max(va, vb)));
+}
+
+/*  Sorts the keys in @a data in place using a bitonic sorting network on
+    vectors of 8 elements. The network is the one for the next power of two
+    number of vectors, the missing vectors being treated as if they contained
+    the maximum key, thus the comparisons with them are skipped. The first
+    stage of each merge compares each vector with the reversed mirrored vector
+    in the other half, so that all stages sort in increasing order. The
+    elements that don't fill a whole vector are inserted into the sorted data
+    afterwards.
+*/
+template<class T>
+void radix_sort_small(typename radix_sort_traits<T>::key* data, std::size_t size)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::small_vec;
+    const unsigned L = V::length;
+    const std::size_t num_vecs = size / L;
+
+    radix_sort_to_keys<T>(data, size);
+
+    for (std::size_t i = 0; i < num_vecs; ++i) {
+        V v = load_u(data + i * L);
+        bitonic_sort_asc(v);
+        store_u(data + i * L, v);
+    }
+
+    for (std::size_t width = 2; width / 2 < num_vecs; width *= 2) {
+        for (std::size_t b = 0; b < num_vecs; b += width) {
+            for (std::size_t i = 0; i < width / 2; ++i) {
+                std::size_t lo = b + i;
+                std::size_t hi = b + width - 1 - i;
+                if (hi >= num_vecs) {
+                    continue;
+                }
+                V v0 = load_u(data + lo * L);
+                V v1 = reverse_8lane(V(load_u(data + hi * L)));
+                store_u(data + lo * L, V(min(v0, v1)));
+                store_u(data + hi * L, reverse_8lane(V(max(v0, v1))));
+            }
+        }
+        for (std::size_t dist = width / 4; dist > 0; dist /= 2) {
+            for (std::size_t i = 0; i + dist < num_vecs; ++i) {
+                if ((i & dist) == 0) {
+                    radix_sort_small_cmp<V>(data + i * L, data + (i + dist) * L);
+                }
+            }
+        }
+        for (std::size_t i = 0; i < num_vecs; ++i) {
+            V v = load_u(data + i * L);
+            store_u(data + i * L, bitonic_sort_8lane_finalize_asc(v));
+        }
+    }
+
+    for (std::size_t i = num_vecs * L; i < size; ++i) {
+        K k, prev;
+        std::memcpy(&k, data + i, sizeof(k));
+        std::size_t j = i;
+        for (; j > 0; --j) {
+            std::memcpy(&prev, data + j - 1, sizeof(prev));
+            if (prev <= k) {
+                break;
+            }
+            std::memcpy(data + j, &prev, sizeof(prev));
+        }
+        std::memcpy(data + j, &k, sizeof(k));
+    }
+
+    radix_sort_from_keys<T>(data, data, size);
+}
+
+template<class T>
+void radix_sort_impl(T* first, std::size_t size, const radix_sort_options& options)
+{
+    using K = typename radix_sort_traits<T>::key;
+    using V = typename radix_sort_traits<T>::vec;
+    const unsigned L = V::length;
+
+    unsigned digit_bits = std::min(std::max(options.digit_bits, 1u), 16u);
+    unsigned num_passes = (sizeof(K) * 8 + digit_bits - 1) / digit_bits;
+    std::size_t radix = std::size_t(1) << digit_bits;
+
+    // The data is accessed only through vector loads and stores or memcpy
+    K* data = reinterpret_cast<K*>(first);
+
+    std::vector<std::size_t> hist(num_passes * radix, 0);
+    radix_sort_histogram<T>(data, size, digit_bits, num_passes, hist.data());
+
+    std::vector<K, aligned_allocator<K, radix_sort_line_bytes>> tmp(size);
+    std::vector<K, aligned_allocator<K, radix_sort_line_bytes>> wc(radix * L);
+    std::vector<std::size_t> begin(radix);
+    std::vector<std::size_t> pos(radix);
+
+    K* src = data;
+    K* dst = tmp.data();
+    for (unsigned p = 0; p < num_passes; ++p) {
+        const std::size_t* h = hist.data() + p * radix;
+
+        // skip the pass if all keys have the same digit
+        K first_key;
+        std::memcpy(&first_key, src, sizeof(first_key));
+        K first_digit = (first_key >> (p * digit_bits)) & ((K(1) << digit_bits) - 1);
+        if (h[first_digit] == size) {
+            continue;
+        }
+
+        radix_sort_scatter<T>(src, dst, size, p * digit_bits, digit_bits, h,
+                              options.non_temporal, wc.data(), begin.data(), pos.data());
+        std::swap(src, dst);
+    }
+
+    radix_sort_from_keys<T>(src, data, size);
+}
+
+} // namespace detail
+
+/** Sorts the elements in the range [first, last) in increasing order using
+    least significant digit radix sort.
+
+    Supported element types are @c int32_t, @c uint32_t, @c float, @c int64_t,
+    @c uint64_t and @c double. Floating-point values are ordered according to
+    the totalOrder predicate of IEEE-754, see sort_total_order().
+
+    In the first pass the data is converted to unsigned integer keys and the
+    histograms of all digits are computed. Each subsequent pass distributes
+    the keys into buckets according to one digit. The output of each bucket
+    is collected in a cache line sized write-combining buffer which is then
+    written to memory using a single vector store. Passes in which all keys
+    have the same digit are skipped. Temporary storage of the size of the
+    input is allocated.
+
+    Arrays smaller than @a options.small_size are sorted in place using a
+    bitonic sorting network instead, thus no memory is allocated for them.
+*/
+template<class T>
+void radix_sort(T* first, T* last,
+                const radix_sort_options& options = radix_sort_options())
+{
+    std::size_t size = last - first;
+    if (size < 2) {
+        return;
+    }
+    using K = typename detail::radix_sort_traits<T>::key;
+    if (size < options.small_size) {
+        detail::radix_sort_small<T>(reinterpret_cast<K*>(first), size);
+        return;
+    }
+    detail::radix_sort_impl(first, size, options);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_RADIX_SORT_H
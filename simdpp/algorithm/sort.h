@@ -0,0 +1,604 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/bitonic_sort.h>
+#include <simdpp/algorithm/bitonic_sort_kv.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace detail {
+
+template<class T> struct sort_traits;
+
+template<> struct sort_traits<std::int32_t> {
+    using vec = int32<8>;
+    static std::int32_t max_value() { return std::numeric_limits<std::int32_t>::max(); }
+};
+
+template<> struct sort_traits<std::uint32_t> {
+    using vec = uint32<8>;
+    static std::uint32_t max_value() { return std::numeric_limits<std::uint32_t>::max(); }
+};
+
+template<> struct sort_traits<float> {
+    using vec = float32<8>;
+    static float max_value() { return std::numeric_limits<float>::infinity(); }
+};
+
+template<> struct sort_traits<std::int64_t> {
+    using vec = int64<8>;
+    static std::int64_t max_value() { return std::numeric_limits<std::int64_t>::max(); }
+};
+
+template<> struct sort_traits<std::uint64_t> {
+    using vec = uint64<8>;
+    static std::uint64_t max_value() { return std::numeric_limits<std::uint64_t>::max(); }
+};
+
+template<> struct sort_traits<double> {
+    using vec = float64<8>;
+    static double max_value() { return std::numeric_limits<double>::infinity(); }
+};
+
+template<class T> struct sort_total_order_traits;
+
+template<> struct sort_total_order_traits<float> {
+    using key = std::int32_t;
+    using vec = int32<8>;
+};
+
+template<> struct sort_total_order_traits<double> {
+    using key = std::int64_t;
+    using vec = int64<8>;
+};
+
+// The number of elements sorted by the in-register network at once
+static const std::size_t sort_network_size = 16;
+
+// The number of elements in a run that is fully sorted before merging it with
+// other runs. The two buffers for the run should fit into L1 cache.
+static const std::size_t sort_block_size = 2048;
+
+/*  Merges two sorted runs @a a and @a b into @a out. The sizes of the runs must
+    be nonzero multiples of 8. All pointers must be aligned to the vector size.
+
+    The merge keeps the 8 largest elements seen so far in a register and merges
+    it with the next 8 elements taken from whichever run has the smaller head
+    element.
+*/
+template<class T>
+void sort_merge_runs(const T* a, std::size_t a_size, const T* b, std::size_t b_size, T* out)
+{
+    using V = typename sort_traits<T>::vec;
+
+    const T* a_end = a + a_size;
+    const T* b_end = b + b_size;
+
+    V lo = load(a);
+    V hi = load(b);
+    a += 8;
+    b += 8;
+    bitonic_merge_asc(lo, hi);
+    store(out, lo);
+    out += 8;
+
+    while (a != a_end && b != b_end) {
+        // select the run without branching as the outcome is unpredictable
+        bool take_a = *a < *b;
+        const T* next = take_a ? a : b;
+        a += take_a ? 8 : 0;
+        b += take_a ? 0 : 8;
+
+        lo = load(next);
+        bitonic_merge_asc(lo, hi);
+        store(out, lo);
+        out += 8;
+    }
+    for (; a != a_end; a += 8, out += 8) {
+        lo = load(a);
+        bitonic_merge_asc(lo, hi);
+        store(out, lo);
+    }
+    for (; b != b_end; b += 8, out += 8) {
+        lo = load(b);
+        bitonic_merge_asc(lo, hi);
+        store(out, lo);
+    }
+    store(out, hi);
+}
+
+// Same as sort_merge_runs, but moves the values together with the keys
+template<class K>
+void sort_merge_runs_kv(const K* ak, const std::uint32_t* av, std::size_t a_size,
+                        const K* bk, const std::uint32_t* bv, std::size_t b_size,
+                        K* out_k, std::uint32_t* out_v)
+{
+    using VK = typename sort_traits<K>::vec;
+    using VV = uint32<8>;
+
+    const K* ak_end = ak + a_size;
+    const K* bk_end = bk + b_size;
+
+    VK lo_k = load(ak);
+    VK hi_k = load(bk);
+    VV lo_v = load(av);
+    VV hi_v = load(bv);
+    ak += 8; av += 8;
+    bk += 8; bv += 8;
+    bitonic_merge_kv_asc(lo_k, hi_k, lo_v, hi_v);
+    store(out_k, lo_k);
+    store(out_v, lo_v);
+    out_k += 8; out_v += 8;
+
+    while (ak != ak_end && bk != bk_end) {
+        bool take_a = *ak < *bk;
+        const K* next_k = take_a ? ak : bk;
+        const std::uint32_t* next_v = take_a ? av : bv;
+        ak += take_a ? 8 : 0; av += take_a ? 8 : 0;
+        bk += take_a ? 0 : 8; bv += take_a ? 0 : 8;
+
+        lo_k = load(next_k);
+        lo_v = load(next_v);
+        bitonic_merge_kv_asc(lo_k, hi_k, lo_v, hi_v);
+        store(out_k, lo_k);
+        store(out_v, lo_v);
+        out_k += 8; out_v += 8;
+    }
+    for (; ak != ak_end; ak += 8, av += 8, out_k += 8, out_v += 8) {
+        lo_k = load(ak);
+        lo_v = load(av);
+        bitonic_merge_kv_asc(lo_k, hi_k, lo_v, hi_v);
+        store(out_k, lo_k);
+        store(out_v, lo_v);
+    }
+    for (; bk != bk_end; bk += 8, bv += 8, out_k += 8, out_v += 8) {
+        lo_k = load(bk);
+        lo_v = load(bv);
+        bitonic_merge_kv_asc(lo_k, hi_k, lo_v, hi_v);
+        store(out_k, lo_k);
+        store(out_v, lo_v);
+    }
+    store(out_k, hi_k);
+    store(out_v, hi_v);
+}
+
+/*  Merges consecutive pairs of sorted runs of length @a width from @a src into
+    @a dst. The last run may be shorter than @a width, in which case it is
+    copied if it has no pair. @a size must be a multiple of 8.
+*/
+template<class T>
+void sort_merge_pass(const T* src, T* dst, std::size_t size, std::size_t width)
+{
+    for (std::size_t i = 0; i < size; i += 2 * width) {
+        if (size - i <= width) {
+            std::copy(src + i, src + size, dst + i);
+            break;
+        }
+        std::size_t b_size = std::min(width, size - i - width);
+        sort_merge_runs(src + i, width, src + i + width, b_size, dst + i);
+    }
+}
+
+template<class K>
+void sort_merge_pass_kv(const K* src_k, const std::uint32_t* src_v,
+                        K* dst_k, std::uint32_t* dst_v,
+                        std::size_t size, std::size_t width)
+{
+    for (std::size_t i = 0; i < size; i += 2 * width) {
+        if (size - i <= width) {
+            std::copy(src_k + i, src_k + size, dst_k + i);
+            std::copy(src_v + i, src_v + size, dst_v + i);
+            break;
+        }
+        std::size_t b_size = std::min(width, size - i - width);
+        sort_merge_runs_kv(src_k + i, src_v + i, width,
+                           src_k + i + width, src_v + i + width, b_size,
+                           dst_k + i, dst_v + i);
+    }
+}
+
+template<class T>
+void sort_network_block(T* data)
+{
+    using V = typename sort_traits<T>::vec;
+
+    V v0 = load(data);
+    V v1 = load(data + 8);
+    bitonic_sort_asc(v0, v1);
+    store(data, v0);
+    store(data + 8, v1);
+}
+
+template<class K>
+void sort_network_block_kv(K* keys, std::uint32_t* values)
+{
+    using VK = typename sort_traits<K>::vec;
+    using VV = uint32<8>;
+
+    VK k0 = load(keys);
+    VK k1 = load(keys + 8);
+    VV v0 = load(values);
+    VV v1 = load(values + 8);
+    bitonic_sort_kv_asc(k0, k1, v0, v1);
+    store(keys, k0);
+    store(keys + 8, k1);
+    store(values, v0);
+    store(values + 8, v1);
+}
+
+/*  Sorts the data in @a src. Both @a src and @a dst must have space for
+    @a padded_size elements which must be a multiple of sort_network_size. On
+    return @a src points to the buffer containing the result and @a dst points
+    to the other buffer.
+
+    The data is first split into blocks that are sorted using the in-register
+    network. The blocks are then merged within cache-sized runs. All runs
+    undergo the same number of passes so that they end up in the same buffer.
+    Finally the runs are merged across the whole array.
+*/
+template<class T>
+void sort_buffers(T*& src, T*& dst, std::size_t padded_size)
+{
+    for (std::size_t i = 0; i < padded_size; i += sort_network_size) {
+        sort_network_block(src + i);
+    }
+
+    std::size_t block_size = std::min(sort_block_size, padded_size);
+    T* block_src = src;
+    T* block_dst = dst;
+    for (std::size_t i = 0; i < padded_size; i += block_size) {
+        std::size_t curr_size = std::min(block_size, padded_size - i);
+        block_src = src;
+        block_dst = dst;
+        for (std::size_t width = sort_network_size; width < block_size; width *= 2) {
+            sort_merge_pass(block_src + i, block_dst + i, curr_size, width);
+            std::swap(block_src, block_dst);
+        }
+    }
+    src = block_src;
+    dst = block_dst;
+
+    for (std::size_t width = block_size; width < padded_size; width *= 2) {
+        sort_merge_pass(src, dst, padded_size, width);
+        std::swap(src, dst);
+    }
+}
+
+// Same as sort_buffers, but moves the values together with the keys
+template<class K>
+void sort_buffers_kv(K*& src_k, K*& dst_k, std::uint32_t*& src_v, std::uint32_t*& dst_v,
+                     std::size_t padded_size)
+{
+    for (std::size_t i = 0; i < padded_size; i += sort_network_size) {
+        sort_network_block_kv(src_k + i, src_v + i);
+    }
+
+    std::size_t block_size = std::min(sort_block_size, padded_size);
+    K* block_src_k = src_k;
+    K* block_dst_k = dst_k;
+    std::uint32_t* block_src_v = src_v;
+    std::uint32_t* block_dst_v = dst_v;
+    for (std::size_t i = 0; i < padded_size; i += block_size) {
+        std::size_t curr_size = std::min(block_size, padded_size - i);
+        block_src_k = src_k;
+        block_dst_k = dst_k;
+        block_src_v = src_v;
+        block_dst_v = dst_v;
+        for (std::size_t width = sort_network_size; width < block_size; width *= 2) {
+            sort_merge_pass_kv(block_src_k + i, block_src_v + i,
+                               block_dst_k + i, block_dst_v + i, curr_size, width);
+            std::swap(block_src_k, block_dst_k);
+            std::swap(block_src_v, block_dst_v);
+        }
+    }
+    src_k = block_src_k;
+    dst_k = block_dst_k;
+    src_v = block_src_v;
+    dst_v = block_dst_v;
+
+    for (std::size_t width = block_size; width < padded_size; width *= 2) {
+        sort_merge_pass_kv(src_k, src_v, dst_k, dst_v, padded_size, width);
+        std::swap(src_k, dst_k);
+        std::swap(src_v, dst_v);
+    }
+}
+
+inline std::size_t sort_padded_size(std::size_t size)
+{
+    return (size + sort_network_size - 1) / sort_network_size * sort_network_size;
+}
+
+/*  Holds the temporary buffers needed to sort @a size elements of type T. The
+    buffers are allocated on the stack when the data fits into a single
+    network block.
+*/
+template<class T>
+class sort_buffer {
+public:
+    sort_buffer(std::size_t size) :
+        padded_size_(sort_padded_size(size))
+    {
+        data_ = small_data_;
+        if (padded_size_ > sort_network_size) {
+            storage_.resize(padded_size_ * 2);
+            data_ = storage_.data();
+        }
+    }
+
+    std::size_t padded_size() const { return padded_size_; }
+    T* first() { return data_; }
+    T* second() { return data_ + padded_size_; }
+
+private:
+    std::size_t padded_size_;
+    T* data_;
+    SIMDPP_ALIGN(64) T small_data_[sort_network_size * 2];
+    std::vector<T, aligned_allocator<T, 64>> storage_;
+};
+
+template<class T>
+void sort_impl(T* first, std::size_t size)
+{
+    sort_buffer<T> buf(size);
+    std::size_t padded_size = buf.padded_size();
+    T* src = buf.first();
+    T* dst = buf.second();
+
+    // The padding elements sort after any other values
+    std::copy(first, first + size, src);
+    std::fill(src + size, src + padded_size, sort_traits<T>::max_value());
+
+    sort_buffers(src, dst, padded_size);
+
+    std::copy(src, src + size, first);
+}
+
+/*  Copies @a size values from @a src to @a dst converting between the bits of
+    floating-point values and signed integers that sort in the order defined
+    by the IEEE-754 totalOrder predicate. All bits except the sign bit are
+    inverted in negative values, which reverses their order. The conversion is
+    its own inverse, thus it is used in both directions.
+*/
+template<class V, class Src, class Dst>
+void sort_total_order_convert(const Src* src, Dst* dst, std::size_t size)
+{
+    using K = typename V::element_type;
+    const unsigned sign_shift = sizeof(K) * 8 - 1;
+
+    std::size_t i = 0;
+    for (; i + V::length <= size; i += V::length) {
+        V v = load_u(src + i);
+        V sign_mask = shift_r<sign_shift>(v);
+        v = bit_xor(v, bit_and(sign_mask, std::numeric_limits<K>::max()));
+        store_u(dst + i, v);
+    }
+    for (; i < size; ++i) {
+        K k;
+        std::memcpy(&k, src + i, sizeof(k));
+        if (k < 0) {
+            k ^= std::numeric_limits<K>::max();
+        }
+        std::memcpy(dst + i, &k, sizeof(k));
+    }
+}
+
+template<class T>
+void sort_total_order_impl(T* first, std::size_t size)
+{
+    using K = typename sort_total_order_traits<T>::key;
+    using V = typename sort_total_order_traits<T>::vec;
+
+    sort_buffer<K> buf(size);
+    std::size_t padded_size = buf.padded_size();
+    K* src = buf.first();
+    K* dst = buf.second();
+
+    // The padding elements are identical to each other, thus they can't be
+    // confused with the actual data even if they are equal to some of it
+    sort_total_order_convert<V>(first, src, size);
+    std::fill(src + size, src + padded_size, std::numeric_limits<K>::max());
+
+    sort_buffers(src, dst, padded_size);
+
+    sort_total_order_convert<V>(src, first, size);
+}
+
+/*  Sorts key/value pairs. @a get_value(i) returns the bits of the value of
+    the i-th pair. The sorted keys are written to @a keys_out unless it is
+    null, the sorted values are written to @a values_out.
+
+    The padding elements must sort strictly after the actual data, otherwise
+    the values of padding and actual elements could be mixed. Thus pairs with
+    the maximum key are excluded from the sort and appended to the result
+    directly. The same is done for pairs with NaN keys, which would otherwise
+    not sort consistently.
+*/
+template<class K, class V, class GetValue>
+void sort_kv_impl(const K* keys, std::size_t size, GetValue get_value,
+                  K* keys_out, V* values_out)
+{
+    static_assert(sizeof(V) == 4, "Only 32-bit values are supported");
+
+    sort_buffer<K> buf_k(size);
+    sort_buffer<std::uint32_t> buf_v(size);
+    K* src_k = buf_k.first();
+    K* dst_k = buf_k.second();
+    std::uint32_t* src_v = buf_v.first();
+    std::uint32_t* dst_v = buf_v.second();
+
+    const K max_key = sort_traits<K>::max_value();
+    std::vector<std::pair<K, std::uint32_t>> max_pairs;
+    std::vector<std::pair<K, std::uint32_t>> nan_pairs;
+
+    std::size_t sorted_size = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        K key = keys[i];
+        if (key < max_key) {
+            src_k[sorted_size] = key;
+            src_v[sorted_size] = get_value(i);
+            sorted_size++;
+        } else if (key == max_key) {
+            max_pairs.emplace_back(key, get_value(i));
+        } else {
+            nan_pairs.emplace_back(key, get_value(i));
+        }
+    }
+
+    if (sorted_size > 0) {
+        std::size_t padded_size = sort_padded_size(sorted_size);
+        std::fill(src_k + sorted_size, src_k + padded_size, max_key);
+        std::fill(src_v + sorted_size, src_v + padded_size, 0);
+        sort_buffers_kv(src_k, dst_k, src_v, dst_v, padded_size);
+    }
+
+    if (keys_out) {
+        std::copy(src_k, src_k + sorted_size, keys_out);
+    }
+    std::memcpy(values_out, src_v, sorted_size * sizeof(V));
+
+    std::size_t pos = sorted_size;
+    for (const auto& pair : max_pairs) {
+        if (keys_out) {
+            keys_out[pos] = pair.first;
+        }
+        std::memcpy(values_out + pos, &pair.second, sizeof(V));
+        pos++;
+    }
+    for (const auto& pair : nan_pairs) {
+        if (keys_out) {
+            keys_out[pos] = pair.first;
+        }
+        std::memcpy(values_out + pos, &pair.second, sizeof(V));
+        pos++;
+    }
+}
+
+} // namespace detail
+
+/** Sorts the elements in the range [first, last) in increasing order. The
+    sort is not stable. NaN values are placed at the end of the range in
+    unspecified order. Use sort_total_order() if NaN values need to be ordered
+    deterministically.
+
+    The data is first split into blocks of 16 elements that are sorted using
+    the in-register bitonic sorting network. The blocks are then merged within
+    cache-sized runs and finally the runs are merged across the whole array.
+    All merges use bitonic merge of two registers. Temporary storage of twice
+    the size of the input is allocated.
+
+    Supported element types are @c int32_t, @c uint32_t, @c float, @c int64_t,
+    @c uint64_t and @c double. 64-bit elements are sorted 8 elements per
+    register, thus the blocks contain 16 elements in both cases.
+
+    The function is compiled for the instruction set of the current
+    compilation unit. To select the best instruction set at runtime, compile
+    a wrapper via the dispatcher in each architecture-specific compilation unit:
+
+    @code
+    namespace SIMDPP_ARCH_NAMESPACE {
+    void sort_float(float* first, float* last) { simdpp::sort(first, last); }
+    }
+    SIMDPP_MAKE_DISPATCHER((void)(sort_float)((float*) first, (float*) last))
+    @endcode
+*/
+template<class T>
+void sort(T* first, T* last)
+{
+    if (std::numeric_limits<T>::has_quiet_NaN) {
+        // NaN values don't sort consistently against the padding elements
+        last = std::partition(first, last, [](T x) { return x == x; });
+    }
+    if (last - first < 2) {
+        return;
+    }
+    detail::sort_impl(first, last - first);
+}
+
+/** Sorts the floating-point values in the range [first, last) according to
+    the totalOrder predicate of IEEE-754:
+
+    @code
+    -NaN < -inf < negative values < -0.0 < +0.0 < positive values < +inf < +NaN
+    @endcode
+
+    NaN values with the same sign are ordered by their payload. Unlike sort(),
+    the result is fully deterministic for any input including NaNs.
+
+    The values are reinterpreted as signed integers with the bits of negative
+    values inverted except the sign bit, sorted using the integer sorting
+    networks and converted back. Thus the function is as fast as sorting
+    integers of the same size.
+
+    Supported element types are @c float and @c double.
+*/
+template<class T>
+void sort_total_order(T* first, T* last)
+{
+    if (last - first < 2) {
+        return;
+    }
+    detail::sort_total_order_impl(first, last - first);
+}
+
+/** Sorts the keys in the range [keys_first, keys_last) in increasing order
+    and applies the same permutation to the values starting at
+    @a values_first. The sort is not stable. Pairs with NaN keys are placed at
+    the end of the range in unspecified order.
+
+    Supported key types are @c int32_t, @c uint32_t and @c float. Values may be
+    of any 32-bit trivially copyable type. See sort() for the description of
+    the algorithm.
+*/
+template<class K, class V>
+void sort_by_key(K* keys_first, K* keys_last, V* values_first)
+{
+    if (keys_last - keys_first < 2) {
+        return;
+    }
+    std::size_t size = keys_last - keys_first;
+    detail::sort_kv_impl(keys_first, size,
+                         [values_first](std::size_t i)
+                         {
+                             std::uint32_t value;
+                             std::memcpy(&value, values_first + i, sizeof(value));
+                             return value;
+                         },
+                         keys_first, values_first);
+}
+
+/** Computes the permutation that sorts the elements in the range
+    [first, last) in increasing order. On return @a indices contains the
+    indices of the elements in sorted order. Ties are broken arbitrarily.
+    Elements with NaN values are placed at the end. The input is not modified.
+
+    Supported element types are @c int32_t, @c uint32_t and @c float.
+*/
+template<class K>
+void argsort(const K* first, const K* last, std::uint32_t* indices)
+{
+    std::size_t size = last - first;
+    detail::sort_kv_impl(first, size,
+                         [](std::size_t i) { return static_cast<std::uint32_t>(i); },
+                         static_cast<K*>(nullptr), indices);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif // LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
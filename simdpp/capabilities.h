@@ -115,4 +115,16 @@
 #define SIMDPP_HAS_UINT32_SHIFT_R_BY_VECTOR 0
 #endif
 
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_XOP || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+#define SIMDPP_HAS_INT8_ROTATE_BY_VECTOR 1
+#define SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR 1
+#define SIMDPP_HAS_INT16_ROTATE_BY_VECTOR 1
+#define SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR 1
+#else
+#define SIMDPP_HAS_INT8_ROTATE_BY_VECTOR 0
+#define SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR 0
+#define SIMDPP_HAS_INT16_ROTATE_BY_VECTOR 0
+#define SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR 0
+#endif
+
 #endif
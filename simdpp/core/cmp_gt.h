@@ -161,7 +161,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_gt, mask_int32, uint32)
     rN = (aN > bN) ? 0xffffffffffff : 0x0
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 mask_int64<N> cmp_gt(const int64<N>& a, const int64<N>& b)
@@ -179,7 +180,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_gt, mask_int64, int64)
     rN = (aN > bN) ? 0xffffffffffff : 0x0
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 mask_int64<N> cmp_gt(const uint64<N>& a, const uint64<N>& b)
@@ -0,0 +1,92 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_FIND_SET_H
+#define LIBSIMDPP_SIMDPP_CORE_FIND_SET_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/find_set.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Returns the index of the first element of a vector that is set, or -1 if
+    no elements are set.
+
+    This operation is only sensible if each element within the vector is either
+    all zeros or all ones, for example the result of a comparison.
+
+    @code
+    r = a0 ? 0 : a1 ? 1 : ... : aN ? N : -1
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+int find_first_set(const any_vec8<N,V>& a)
+{
+    return detail::insn::i_find_first_set(uint8<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_first_set(const any_vec16<N,V>& a)
+{
+    return detail::insn::i_find_first_set(uint16<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_first_set(const any_vec32<N,V>& a)
+{
+    return detail::insn::i_find_first_set(uint32<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_first_set(const any_vec64<N,V>& a)
+{
+    return detail::insn::i_find_first_set(uint64<N>(a.wrapped()));
+}
+
+/** Returns the index of the last element of a vector that is set, or -1 if
+    no elements are set.
+
+    This operation is only sensible if each element within the vector is either
+    all zeros or all ones, for example the result of a comparison.
+
+    @code
+    r = aN ? N : ... : a1 ? 1 : a0 ? 0 : -1
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+int find_last_set(const any_vec8<N,V>& a)
+{
+    return detail::insn::i_find_last_set(uint8<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_last_set(const any_vec16<N,V>& a)
+{
+    return detail::insn::i_find_last_set(uint16<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_last_set(const any_vec32<N,V>& a)
+{
+    return detail::insn::i_find_last_set(uint32<N>(a.wrapped()));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+int find_last_set(const any_vec64<N,V>& a)
+{
+    return detail::insn::i_find_last_set(uint64<N>(a.wrapped()));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,158 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/gather.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements at the locations @a base[idx[i]] into a vector. The
+    elements of @a idx are signed 32-bit indices, thus unsigned indices must
+    not exceed 2^31-1. The type of the returned vector is determined by the
+    type of @a base.
+
+    @code
+    r0 = base[idx0]
+    ...
+    rN = base[idxN]
+    @endcode
+
+    Vectors of 64-bit elements must contain at least 4 elements, as the index
+    vector has half the size of the result.
+
+    Implemented natively on AVX2 and AVX512F. On other instruction sets the
+    elements are loaded one by one.
+*/
+template<unsigned N, class I> SIMDPP_INL
+int32<N> gather(const int32_t* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return (int32<N>) r;
+}
+template<unsigned N, class I> SIMDPP_INL
+uint32<N> gather(const uint32_t* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return r;
+}
+template<unsigned N, class I> SIMDPP_INL
+float32<N> gather(const float* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return bit_cast<float32<N>>(r);
+}
+template<unsigned N, class I> SIMDPP_INL
+int64<N> gather(const int64_t* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return (int64<N>) r;
+}
+template<unsigned N, class I> SIMDPP_INL
+uint64<N> gather(const uint64_t* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return r;
+}
+template<unsigned N, class I> SIMDPP_INL
+float64<N> gather(const double* base, const any_int32<N,I>& idx)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather(r, reinterpret_cast<const char*>(base), ridx);
+    return bit_cast<float64<N>>(r);
+}
+
+/** Loads the elements at the locations @a base[idx[i]] into the elements of a
+    vector that are selected by @a mask. The elements that are not selected
+    are set to zero and the corresponding locations are not accessed.
+
+    @code
+    r0 = mask0 ? base[idx0] : 0
+    ...
+    rN = maskN ? base[idxN] : 0
+    @endcode
+
+    See gather() for further details.
+*/
+template<unsigned N, class I> SIMDPP_INL
+int32<N> gather_masked(const int32_t* base, const any_int32<N,I>& idx, const mask_int32<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  mask);
+    return (int32<N>) r;
+}
+template<unsigned N, class I> SIMDPP_INL
+uint32<N> gather_masked(const uint32_t* base, const any_int32<N,I>& idx, const mask_int32<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  mask);
+    return r;
+}
+template<unsigned N, class I> SIMDPP_INL
+float32<N> gather_masked(const float* base, const any_int32<N,I>& idx, const mask_float32<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  bit_cast<mask_int32<N>>(mask));
+    return bit_cast<float32<N>>(r);
+}
+template<unsigned N, class I> SIMDPP_INL
+int64<N> gather_masked(const int64_t* base, const any_int32<N,I>& idx, const mask_int64<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  mask);
+    return (int64<N>) r;
+}
+template<unsigned N, class I> SIMDPP_INL
+uint64<N> gather_masked(const uint64_t* base, const any_int32<N,I>& idx, const mask_int64<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  mask);
+    return r;
+}
+template<unsigned N, class I> SIMDPP_INL
+float64<N> gather_masked(const double* base, const any_int32<N,I>& idx, const mask_float64<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> r;
+    detail::insn::i_gather_masked(r, reinterpret_cast<const char*>(base), ridx,
+                                  bit_cast<mask_int64<N>>(mask));
+    return bit_cast<float64<N>>(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,70 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_BIT_WIDTH_H
+#define LIBSIMDPP_SIMDPP_CORE_I_BIT_WIDTH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/detail/insn/i_bit_width.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the number of bits needed to represent each element, i.e. the
+    index of the highest set bit plus one. Zero elements produce zero.
+
+    @code
+    r0 = a0 == 0 ? 0 : floor(log2(a0)) + 1
+    ...
+    rN = aN == 0 ? 0 : floor(log2(aN)) + 1
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> bit_width(const uint32<N>& a)
+{
+    return detail::insn::i_bit_width(a);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> bit_width(const uint64<N>& a)
+{
+    return detail::insn::i_bit_width(a);
+}
+
+/** Computes the integer base-2 logarithm of each element, i.e. the index of
+    the highest set bit. The result for zero elements is all ones, that is -1
+    when interpreted as a signed integer.
+
+    @code
+    r0 = floor(log2(a0))
+    ...
+    rN = floor(log2(aN))
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> ilog2(const uint32<N>& a)
+{
+    uint32<N> one = splat(1);
+    return sub(detail::insn::i_bit_width(a), one);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> ilog2(const uint64<N>& a)
+{
+    uint64<N> one = splat(1);
+    return sub(detail::insn::i_bit_width(a), one);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
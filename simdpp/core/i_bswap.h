@@ -0,0 +1,115 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_BSWAP_H
+#define LIBSIMDPP_SIMDPP_CORE_I_BSWAP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_bswap.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Reverses the order of the bytes within each 16-bit element.
+
+    @code
+    r0 = bswap(a0)
+    ...
+    rN = bswap(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, 3}
+    @icost{SSSE3-AVX2, 1-2}
+
+    @par 256-bit version:
+    @icost{SSE2, 6}
+    @icost{SSSE3-AVX, 2-3}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N> SIMDPP_INL
+int16<N> bswap(const int16<N>& a)
+{
+    uint16<N> qa = a;
+    return detail::insn::i_bswap(qa);
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> bswap(const uint16<N>& a)
+{
+    return detail::insn::i_bswap(a);
+}
+
+/** Reverses the order of the bytes within each 32-bit element.
+
+    @code
+    r0 = bswap(a0)
+    ...
+    rN = bswap(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, 5}
+    @icost{SSSE3-AVX2, 1-2}
+
+    @par 256-bit version:
+    @icost{SSE2, 10}
+    @icost{SSSE3-AVX, 2-3}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> bswap(const int32<N>& a)
+{
+    uint32<N> qa = a;
+    return detail::insn::i_bswap(qa);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> bswap(const uint32<N>& a)
+{
+    return detail::insn::i_bswap(a);
+}
+
+/** Reverses the order of the bytes within each 64-bit element.
+
+    @code
+    r0 = bswap(a0)
+    ...
+    rN = bswap(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, 5}
+    @icost{SSSE3-AVX2, 1-2}
+
+    @par 256-bit version:
+    @icost{SSE2, 10}
+    @icost{SSSE3-AVX, 2-3}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N> SIMDPP_INL
+int64<N> bswap(const int64<N>& a)
+{
+    uint64<N> qa = a;
+    return detail::insn::i_bswap(qa);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> bswap(const uint64<N>& a)
+{
+    return detail::insn::i_bswap(a);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
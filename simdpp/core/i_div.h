@@ -0,0 +1,202 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_div.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Holds the precomputed data for the division of integer vectors by a
+    divisor that is known only at runtime. The division is replaced by a
+    multiplication returning the high half of the result and a couple of
+    shifts, which is much faster than the integer division instructions or
+    the emulation of them. Constructing the object is relatively expensive,
+    thus it should be reused for many divisions.
+
+    @a T is the element type of the vectors that are divided: @c int8_t,
+    @c uint8_t, @c int16_t, @c uint16_t, @c int32_t, @c uint32_t, @c int64_t or
+    @c uint64_t.
+
+    The divisor must not be zero. Division of the most negative value by -1
+    wraps around to the most negative value.
+
+    @code
+    divider<uint32_t> d(7);
+    uint32<8> q = div(a, d);
+    uint32<8> r = mod(a, d);
+    @endcode
+*/
+template<class T>
+class divider {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 8,
+                  "T must be an integer type of at most 64 bits");
+public:
+    using value_type = T;
+
+    explicit divider(T d) : d_(d)
+    {
+        init(std::integral_constant<bool, std::is_signed<T>::value>());
+    }
+
+    /// Returns the divisor
+    T divisor() const { return d_; }
+
+    // The following are implementation details
+    T magic() const { return magic_; }
+    unsigned pre_shift() const { return pre_shift_; }
+    unsigned post_shift() const { return post_shift_; }
+
+private:
+    void init(std::false_type)
+    {
+        magic_ = T(detail::div_magic_unsigned(d_, sizeof(T) * 8,
+                                              pre_shift_, post_shift_));
+    }
+
+    void init(std::true_type)
+    {
+        uint64_t ad = d_ < 0 ? uint64_t(0) - uint64_t(int64_t(d_)) : uint64_t(d_);
+        pre_shift_ = 0;
+        magic_ = T(detail::div_magic_signed(ad, sizeof(T) * 8, post_shift_));
+    }
+
+    T d_;
+    T magic_;
+    unsigned pre_shift_;
+    unsigned post_shift_;
+};
+
+/** Divides each element by the divisor held by @a d. The result is rounded
+    towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    8-bit elements are processed as 16-bit elements.
+*/
+template<unsigned N> SIMDPP_INL
+uint8<N> div(const uint8<N>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> div(const int8<N>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> div(const uint16<N>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> div(const int16<N>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> div(const uint32<N>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> div(const int32<N>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> div(const uint64<N>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> div(const int64<N>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_div(a, d);
+}
+
+/** Computes the remainder of the division of each element by the divisor held
+    by @a d. The result has the same sign as the dividend.
+
+    @code
+    r0 = a0 % d
+    ...
+    rN = aN % d
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+uint8<N> mod(const uint8<N>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> mod(const int8<N>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> mod(const uint16<N>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> mod(const int16<N>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> mod(const uint32<N>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> mod(const int32<N>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> mod(const uint64<N>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> mod(const int64<N>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_mod(a, d);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
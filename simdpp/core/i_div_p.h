@@ -36,6 +36,9 @@ namespace SIMDPP_ARCH_NAMESPACE {
     @par 128-bit version:
     The operations costs at least 9 instructions per bit of precision.
 
+    When all elements are divided by the same divisor, div() with a divider
+    object is much faster.
+
     @par 256-bit version:
     @icost{SSE2-AVX, NEON, 10}
     @icost{AVX2, 4}
@@ -0,0 +1,138 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_LZCNT_H
+#define LIBSIMDPP_SIMDPP_CORE_I_LZCNT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_lzcnt.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Counts the number of leading zero bits in each element. Zero elements
+    produce the width of the element in bits.
+
+    @code
+    r0 = lzcnt(a0)
+    ...
+    rN = lzcnt(aN)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int8<N> lzcnt(const int8<N>& a)
+{
+    return detail::insn::i_lzcnt(uint8<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> lzcnt(const uint8<N>& a)
+{
+    return detail::insn::i_lzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> lzcnt(const int16<N>& a)
+{
+    return detail::insn::i_lzcnt(uint16<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> lzcnt(const uint16<N>& a)
+{
+    return detail::insn::i_lzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> lzcnt(const int32<N>& a)
+{
+    return detail::insn::i_lzcnt(uint32<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> lzcnt(const uint32<N>& a)
+{
+    return detail::insn::i_lzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> lzcnt(const int64<N>& a)
+{
+    return detail::insn::i_lzcnt(uint64<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> lzcnt(const uint64<N>& a)
+{
+    return detail::insn::i_lzcnt(a);
+}
+
+/** Counts the number of trailing zero bits in each element. Zero elements
+    produce the width of the element in bits.
+
+    @code
+    r0 = tzcnt(a0)
+    ...
+    rN = tzcnt(aN)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int8<N> tzcnt(const int8<N>& a)
+{
+    return detail::insn::i_tzcnt(uint8<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> tzcnt(const uint8<N>& a)
+{
+    return detail::insn::i_tzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> tzcnt(const int16<N>& a)
+{
+    return detail::insn::i_tzcnt(uint16<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> tzcnt(const uint16<N>& a)
+{
+    return detail::insn::i_tzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> tzcnt(const int32<N>& a)
+{
+    return detail::insn::i_tzcnt(uint32<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> tzcnt(const uint32<N>& a)
+{
+    return detail::insn::i_tzcnt(a);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> tzcnt(const int64<N>& a)
+{
+    return detail::insn::i_tzcnt(uint64<N>(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> tzcnt(const uint64<N>& a)
+{
+    return detail::insn::i_tzcnt(a);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -158,7 +158,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(max, uint32, uint32)
     rN = max(aN, bN)
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 int64<N> max(const int64<N>& a, const int64<N>& b)
@@ -176,7 +177,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(max, int64, int64)
     rN = max(aN, bN)
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 uint64<N> max(const uint64<N>& a, const uint64<N>& b)
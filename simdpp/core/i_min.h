@@ -159,7 +159,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(min, uint32, uint32)
     rN = min(aN, bN)
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 int64<N> min(const int64<N>& a, const int64<N>& b)
@@ -177,7 +178,8 @@ SIMDPP_SCALAR_ARG_IMPL_VEC(min, int64, int64)
     rN = min(aN, bN)
     @endcode
 
-    Supported since AVX2, NEON64. Not supported on ALTIVEC.
+    Supported since SSE2 (emulated via 32-bit comparisons on SSE2-SSE4.1),
+    NEON64. Not supported on ALTIVEC.
 */
 template<unsigned N> SIMDPP_INL
 uint64<N> min(const uint64<N>& a, const uint64<N>& b)
@@ -124,6 +124,146 @@ typename detail::get_expr_uint<V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int32, int32<N>)
 
+/** Multiplies signed 32-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 13}
+    @icost{SSE4.1-AVX, 6}
+    @icost{NEON, 3}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 26}
+    @icost{SSE4.1-AVX, 12}
+    @icost{AVX2, 6}
+    @icost{NEON, 6}
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> mul_hi(const int32<N>& a, const int32<N>& b)
+{
+    return detail::insn::i_mul_hi(a.wrapped(), b.wrapped());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(mul_hi, int32, int32)
+
+/** Multiplies unsigned 32-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 7}
+    @icost{SSE4.1-AVX, 6}
+    @icost{NEON, 3}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 14}
+    @icost{SSE4.1-AVX, 12}
+    @icost{AVX2, 6}
+    @icost{NEON, 6}
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> mul_hi(const uint32<N>& a, const uint32<N>& b)
+{
+    return detail::insn::i_mul_hi(a.wrapped(), b.wrapped());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(mul_hi, uint32, uint32)
+
+/** Multiplies 64-bit values and returns the lower half of the result.
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, AVX512F, 8}
+    @icost{NEON, 5}
+    @icost{ALTIVEC, VSX, 12-15}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 16}
+    @icost{AVX2, AVX512F, 8}
+    @icost{NEON, 10}
+
+    With AVX512DQ (and AVX512VL for 128-bit and 256-bit vectors) a single
+    instruction is used.
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<V1, V2>::type
+        mul_lo(const any_int64<N,V1>& a, const any_int64<N,V2>& b)
+{
+    typename detail::get_expr_uint<V1, V2>::v1_final_type ra;
+    typename detail::get_expr_uint<V1, V2>::v2_final_type rb;
+    ra = a.wrapped();
+    rb = b.wrapped();
+    return detail::insn::i_mul_lo(ra, rb);
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int64, int64<N>)
+
+/** Multiplies signed 64-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, AVX512F, 20}
+    @icost{NEON, 16}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 40}
+    @icost{AVX2, AVX512F, 20}
+    @icost{NEON, 32}
+*/
+template<unsigned N> SIMDPP_INL
+int64<N> mul_hi(const int64<N>& a, const int64<N>& b)
+{
+    return detail::insn::i_mul_hi(a.wrapped(), b.wrapped());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(mul_hi, int64, int64)
+
+/** Multiplies unsigned 64-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, AVX512F, 14}
+    @icost{NEON, 10}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 28}
+    @icost{AVX2, AVX512F, 14}
+    @icost{NEON, 20}
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> mul_hi(const uint64<N>& a, const uint64<N>& b)
+{
+    return detail::insn::i_mul_hi(a.wrapped(), b.wrapped());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(mul_hi, uint64, uint64)
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
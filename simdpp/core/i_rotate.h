@@ -0,0 +1,627 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/detail/insn/i_rotate.h>
+#include <simdpp/detail/not_implemented.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// -----------------------------------------------------------------------------
+// rotate by compile-time constant
+
+/** Rotates 8-bit values left by @a count bits.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (8 - count))
+    ...
+    rN = (aN << count) | (aN >> (8 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int8<N> rotate_l(const int8<N>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    uint8<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint8<N> rotate_l(const uint8<N>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a);
+}
+
+/** Rotates 16-bit values left by @a count bits.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (16 - count))
+    ...
+    rN = (aN << count) | (aN >> (16 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int16<N> rotate_l(const int16<N>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    uint16<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint16<N> rotate_l(const uint16<N>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a);
+}
+
+/** Rotates 32-bit values left by @a count bits.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (32 - count))
+    ...
+    rN = (aN << count) | (aN >> (32 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int32<N> rotate_l(const int32<N>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    uint32<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint32<N> rotate_l(const uint32<N>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a);
+}
+
+/** Rotates 64-bit values left by @a count bits.
+
+    @code
+    r0 = (a0 << count) | (a0 >> (64 - count))
+    ...
+    rN = (aN << count) | (aN >> (64 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int64<N> rotate_l(const int64<N>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    uint64<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint64<N> rotate_l(const uint64<N>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<count>(a);
+}
+
+/** Rotates 8-bit values right by @a count bits.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (8 - count))
+    ...
+    rN = (aN >> count) | (aN << (8 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int8<N> rotate_r(const int8<N>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    uint8<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(8 - count) % 8>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint8<N> rotate_r(const uint8<N>& a)
+{
+    static_assert(count < 8, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(8 - count) % 8>(a);
+}
+
+/** Rotates 16-bit values right by @a count bits.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (16 - count))
+    ...
+    rN = (aN >> count) | (aN << (16 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int16<N> rotate_r(const int16<N>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    uint16<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(16 - count) % 16>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint16<N> rotate_r(const uint16<N>& a)
+{
+    static_assert(count < 16, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(16 - count) % 16>(a);
+}
+
+/** Rotates 32-bit values right by @a count bits.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (32 - count))
+    ...
+    rN = (aN >> count) | (aN << (32 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int32<N> rotate_r(const int32<N>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    uint32<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(32 - count) % 32>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint32<N> rotate_r(const uint32<N>& a)
+{
+    static_assert(count < 32, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(32 - count) % 32>(a);
+}
+
+/** Rotates 64-bit values right by @a count bits.
+
+    @code
+    r0 = (a0 >> count) | (a0 << (64 - count))
+    ...
+    rN = (aN >> count) | (aN << (64 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int64<N> rotate_r(const int64<N>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    uint64<N> qa = a;
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(64 - count) % 64>(qa);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint64<N> rotate_r(const uint64<N>& a)
+{
+    static_assert(count < 64, "Rotate out of bounds");
+    return detail::insn::i_rotate_l_wrapper<count == 0>::template run<(64 - count) % 64>(a);
+}
+
+// -----------------------------------------------------------------------------
+// rotate by vector
+
+/** Rotates 8-bit values left by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 8.
+
+    @code
+    r0 = rotate_l(a0, count0 % 8)
+    ...
+    rN = rotate_l(aN, countN % 8)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int8<N> rotate_l(const int8<N>& a, const uint8<N>& count)
+{
+#if SIMDPP_HAS_INT8_ROTATE_BY_VECTOR
+    uint8<N> qa = a;
+    return detail::insn::i_rotate_l_v(qa, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> rotate_l(const uint8<N>& a, const uint8<N>& count)
+{
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    return detail::insn::i_rotate_l_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+/** Rotates 16-bit values left by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 16.
+
+    @code
+    r0 = rotate_l(a0, count0 % 16)
+    ...
+    rN = rotate_l(aN, countN % 16)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int16<N> rotate_l(const int16<N>& a, const uint16<N>& count)
+{
+#if SIMDPP_HAS_INT16_ROTATE_BY_VECTOR
+    uint16<N> qa = a;
+    return detail::insn::i_rotate_l_v(qa, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> rotate_l(const uint16<N>& a, const uint16<N>& count)
+{
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    return detail::insn::i_rotate_l_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+/** Rotates 32-bit values left by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 32.
+
+    @code
+    r0 = rotate_l(a0, count0 % 32)
+    ...
+    rN = rotate_l(aN, countN % 32)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> rotate_l(const int32<N>& a, const uint32<N>& count)
+{
+    uint32<N> qa = a;
+    return detail::insn::i_rotate_l_v(qa, count);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> rotate_l(const uint32<N>& a, const uint32<N>& count)
+{
+    return detail::insn::i_rotate_l_v(a, count);
+}
+
+/** Rotates 64-bit values left by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 64.
+
+    @code
+    r0 = rotate_l(a0, count0 % 64)
+    ...
+    rN = rotate_l(aN, countN % 64)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int64<N> rotate_l(const int64<N>& a, const uint64<N>& count)
+{
+    uint64<N> qa = a;
+    return detail::insn::i_rotate_l_v(qa, count);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> rotate_l(const uint64<N>& a, const uint64<N>& count)
+{
+    return detail::insn::i_rotate_l_v(a, count);
+}
+
+/** Rotates 8-bit values right by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 8.
+
+    @code
+    r0 = rotate_r(a0, count0 % 8)
+    ...
+    rN = rotate_r(aN, countN % 8)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int8<N> rotate_r(const int8<N>& a, const uint8<N>& count)
+{
+#if SIMDPP_HAS_INT8_ROTATE_BY_VECTOR
+    uint8<N> qa = a;
+    return detail::insn::i_rotate_r_v(qa, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> rotate_r(const uint8<N>& a, const uint8<N>& count)
+{
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    return detail::insn::i_rotate_r_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+/** Rotates 16-bit values right by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 16.
+
+    @code
+    r0 = rotate_r(a0, count0 % 16)
+    ...
+    rN = rotate_r(aN, countN % 16)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int16<N> rotate_r(const int16<N>& a, const uint16<N>& count)
+{
+#if SIMDPP_HAS_INT16_ROTATE_BY_VECTOR
+    uint16<N> qa = a;
+    return detail::insn::i_rotate_r_v(qa, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> rotate_r(const uint16<N>& a, const uint16<N>& count)
+{
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    return detail::insn::i_rotate_r_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE_N2(N, a, count);
+#endif
+}
+
+/** Rotates 32-bit values right by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 32.
+
+    @code
+    r0 = rotate_r(a0, count0 % 32)
+    ...
+    rN = rotate_r(aN, countN % 32)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> rotate_r(const int32<N>& a, const uint32<N>& count)
+{
+    uint32<N> qa = a;
+    return detail::insn::i_rotate_r_v(qa, count);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> rotate_r(const uint32<N>& a, const uint32<N>& count)
+{
+    return detail::insn::i_rotate_r_v(a, count);
+}
+
+/** Rotates 64-bit values right by the number of bits in corresponding element
+    in the given count vector. The counts are taken modulo 64.
+
+    @code
+    r0 = rotate_r(a0, count0 % 64)
+    ...
+    rN = rotate_r(aN, countN % 64)
+    @endcode
+*/
+template<unsigned N> SIMDPP_INL
+int64<N> rotate_r(const int64<N>& a, const uint64<N>& count)
+{
+    uint64<N> qa = a;
+    return detail::insn::i_rotate_r_v(qa, count);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> rotate_r(const uint64<N>& a, const uint64<N>& count)
+{
+    return detail::insn::i_rotate_r_v(a, count);
+}
+
+// -----------------------------------------------------------------------------
+// funnel shift by compile-time constant
+
+/** Concatenates each 8-bit element of @a a with the corresponding element of
+    @a b, shifts the resulting 16-bit value left by @a count bits and returns
+    the high half. @a a forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 << count) | (b0 >> (8 - count))
+    ...
+    rN = (aN << count) | (bN >> (8 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int8<N> shift_l2(const int8<N>& a, const int8<N>& b)
+{
+    static_assert(count < 8, "Shift out of bounds");
+    uint8<N> qa = a, qb = b;
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint8<N> shift_l2(const uint8<N>& a, const uint8<N>& b)
+{
+    static_assert(count < 8, "Shift out of bounds");
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 16-bit element of @a a with the corresponding element of
+    @a b, shifts the resulting 32-bit value left by @a count bits and returns
+    the high half. @a a forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 << count) | (b0 >> (16 - count))
+    ...
+    rN = (aN << count) | (bN >> (16 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int16<N> shift_l2(const int16<N>& a, const int16<N>& b)
+{
+    static_assert(count < 16, "Shift out of bounds");
+    uint16<N> qa = a, qb = b;
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint16<N> shift_l2(const uint16<N>& a, const uint16<N>& b)
+{
+    static_assert(count < 16, "Shift out of bounds");
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 32-bit element of @a a with the corresponding element of
+    @a b, shifts the resulting 64-bit value left by @a count bits and returns
+    the high half. @a a forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 << count) | (b0 >> (32 - count))
+    ...
+    rN = (aN << count) | (bN >> (32 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int32<N> shift_l2(const int32<N>& a, const int32<N>& b)
+{
+    static_assert(count < 32, "Shift out of bounds");
+    uint32<N> qa = a, qb = b;
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint32<N> shift_l2(const uint32<N>& a, const uint32<N>& b)
+{
+    static_assert(count < 32, "Shift out of bounds");
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 64-bit element of @a a with the corresponding element of
+    @a b, shifts the resulting 128-bit value left by @a count bits and returns
+    the high half. @a a forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 << count) | (b0 >> (64 - count))
+    ...
+    rN = (aN << count) | (bN >> (64 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int64<N> shift_l2(const int64<N>& a, const int64<N>& b)
+{
+    static_assert(count < 64, "Shift out of bounds");
+    uint64<N> qa = a, qb = b;
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint64<N> shift_l2(const uint64<N>& a, const uint64<N>& b)
+{
+    static_assert(count < 64, "Shift out of bounds");
+    return detail::insn::i_shift_l2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 8-bit element of @a b with the corresponding element of
+    @a a, shifts the resulting 16-bit value right by @a count bits and returns
+    the low half. @a b forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 >> count) | (b0 << (8 - count))
+    ...
+    rN = (aN >> count) | (bN << (8 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int8<N> shift_r2(const int8<N>& a, const int8<N>& b)
+{
+    static_assert(count < 8, "Shift out of bounds");
+    uint8<N> qa = a, qb = b;
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint8<N> shift_r2(const uint8<N>& a, const uint8<N>& b)
+{
+    static_assert(count < 8, "Shift out of bounds");
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 16-bit element of @a b with the corresponding element of
+    @a a, shifts the resulting 32-bit value right by @a count bits and returns
+    the low half. @a b forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 >> count) | (b0 << (16 - count))
+    ...
+    rN = (aN >> count) | (bN << (16 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int16<N> shift_r2(const int16<N>& a, const int16<N>& b)
+{
+    static_assert(count < 16, "Shift out of bounds");
+    uint16<N> qa = a, qb = b;
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint16<N> shift_r2(const uint16<N>& a, const uint16<N>& b)
+{
+    static_assert(count < 16, "Shift out of bounds");
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 32-bit element of @a b with the corresponding element of
+    @a a, shifts the resulting 64-bit value right by @a count bits and returns
+    the low half. @a b forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 >> count) | (b0 << (32 - count))
+    ...
+    rN = (aN >> count) | (bN << (32 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int32<N> shift_r2(const int32<N>& a, const int32<N>& b)
+{
+    static_assert(count < 32, "Shift out of bounds");
+    uint32<N> qa = a, qb = b;
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint32<N> shift_r2(const uint32<N>& a, const uint32<N>& b)
+{
+    static_assert(count < 32, "Shift out of bounds");
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+/** Concatenates each 64-bit element of @a b with the corresponding element of
+    @a a, shifts the resulting 128-bit value right by @a count bits and returns
+    the low half. @a b forms the high half of the concatenated value.
+
+    @code
+    r0 = (a0 >> count) | (b0 << (64 - count))
+    ...
+    rN = (aN >> count) | (bN << (64 - count))
+    @endcode
+*/
+template<unsigned count, unsigned N> SIMDPP_INL
+int64<N> shift_r2(const int64<N>& a, const int64<N>& b)
+{
+    static_assert(count < 64, "Shift out of bounds");
+    uint64<N> qa = a, qb = b;
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(qa, qb);
+}
+
+template<unsigned count, unsigned N> SIMDPP_INL
+uint64<N> shift_r2(const uint64<N>& a, const uint64<N>& b)
+{
+    static_assert(count < 64, "Shift out of bounds");
+    return detail::insn::i_shift_r2_wrapper<count == 0>::template run<count>(a, b);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
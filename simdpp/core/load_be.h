@@ -0,0 +1,57 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_BE_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_BE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/i_bswap.h>
+#include <simdpp/core/load_u.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads a vector of 16-bit, 32-bit or 64-bit integers stored in big-endian
+    byte order from an unaligned memory location. The elements are converted
+    to the native byte order.
+
+    @code
+    r0 = from_big_endian(p[0])
+    ...
+    rN = from_big_endian(p[N])
+    @endcode
+
+    @a p must be aligned to the element size. See load_u() for the details
+    about memory accesses.
+
+    On little-endian architectures, this function is equivalent to
+    bswap(load_u<V>(p)), otherwise to load_u<V>(p).
+*/
+template<class V, class T> SIMDPP_INL
+V load_be(const T* p)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value &&
+                  (V::type_tag == SIMDPP_TAG_INT || V::type_tag == SIMDPP_TAG_UINT) &&
+                  V::num_bits >= 16,
+                  "V must be a vector of 16-bit, 32-bit or 64-bit integers");
+    V r = load_u<V>(p);
+#if SIMDPP_BIG_ENDIAN
+    return r;
+#else
+    return bswap(r);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,85 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_EXPAND_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_EXPAND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/load_expand.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads consecutive elements starting at @a p into the elements of a vector
+    that are selected by @a mask. The relative order of the elements is
+    preserved. The elements that are not selected are set to zero. This is
+    the inverse of store_compress().
+
+    The memory range of the whole vector starting at @a p must be readable,
+    even though only as many elements as there are selected lanes are used.
+
+    The pointer does not need to be aligned.
+
+    Implemented natively for 32-bit and 64-bit elements on AVX512F (AVX512VL
+    for 128-bit and 256-bit vectors). Elsewhere the elements are moved using
+    a lookup table of byte permutations. On SSE2-SSE3 the elements are loaded
+    one by one.
+*/
+template<class T, unsigned N> SIMDPP_INL
+uint8<N> load_expand(const T* p, const mask_int8<N>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p), mask);
+    return r;
+}
+template<class T, unsigned N> SIMDPP_INL
+uint16<N> load_expand(const T* p, const mask_int16<N>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p), mask);
+    return r;
+}
+template<class T, unsigned N> SIMDPP_INL
+uint32<N> load_expand(const T* p, const mask_int32<N>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p), mask);
+    return r;
+}
+template<class T, unsigned N> SIMDPP_INL
+uint64<N> load_expand(const T* p, const mask_int64<N>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p), mask);
+    return r;
+}
+template<class T, unsigned N> SIMDPP_INL
+float32<N> load_expand(const T* p, const mask_float32<N>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p),
+                                bit_cast<mask_int32<N>>(mask));
+    return bit_cast<float32<N>>(r);
+}
+template<class T, unsigned N> SIMDPP_INL
+float64<N> load_expand(const T* p, const mask_float64<N>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_expand(r, reinterpret_cast<const char*>(p),
+                                bit_cast<mask_int64<N>>(mask));
+    return bit_cast<float64<N>>(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
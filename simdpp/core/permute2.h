@@ -47,7 +47,7 @@ typename detail::get_expr_nomask<V>::type
         permute2(const any_vec16<N,V>& a)
 {
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
-    typename detail::get_expr_nomask<V>::type ra;
+    typename detail::get_expr_nomask_nosign<V>::type ra;
     ra = a.wrapped();
     return detail::insn::i_permute2<s0,s1>(ra);
 }
@@ -92,7 +92,7 @@ typename detail::get_expr_nomask<V>::type
         permute2(const any_vec32<N,V>& a)
 {
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
-    typename detail::get_expr_nomask<V>::type ra;
+    typename detail::get_expr_nomask_nosign<V>::type ra;
     ra = a.wrapped();
     return detail::insn::i_permute2<s0,s1>(ra);
 }
@@ -123,7 +123,7 @@ typename detail::get_expr_nomask<V>::type
         permute2(const any_vec64<N,V>& a)
 {
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
-    typename detail::get_expr_nomask<V>::type ra;
+    typename detail::get_expr_nomask_nosign<V>::type ra;
     ra = a.wrapped();
     return detail::insn::i_permute2<s0,s1>(ra);
 }
@@ -0,0 +1,72 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_PERMUTE_VAR_H
+#define LIBSIMDPP_SIMDPP_CORE_PERMUTE_VAR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/insn/permute_var.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Selects elements from a vector according to a vector of indices. Unlike
+    permute_bytes16(), the elements are selected across the whole vector. Each
+    element of @a idx defines which element of @a a to select. The index is
+    taken modulo the number of elements in the vector.
+
+    @code
+    r0 = a[idx0 % N]
+    ...
+    rN = a[idxN % N]
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+typename detail::get_expr_nomask<V>::type
+    permute_var(const any_vec8<N,V>& a, const uint8<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V>::type;
+    R ra = a.wrapped();
+    return (R) detail::insn::i_permute_var(uint8<N>(ra), idx);
+}
+
+template<unsigned N, class V> SIMDPP_INL
+typename detail::get_expr_nomask<V>::type
+    permute_var(const any_vec16<N,V>& a, const uint16<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V>::type;
+    R ra = a.wrapped();
+    return (R) detail::insn::i_permute_var(uint16<N>(ra), idx);
+}
+
+template<unsigned N, class V> SIMDPP_INL
+typename detail::get_expr_nomask<V>::type
+    permute_var(const any_vec32<N,V>& a, const uint32<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V>::type;
+    R ra = a.wrapped();
+    return (R) detail::insn::i_permute_var(uint32<N>(ra), idx);
+}
+
+template<unsigned N, class V> SIMDPP_INL
+typename detail::get_expr_nomask<V>::type
+    permute_var(const any_vec64<N,V>& a, const uint64<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V>::type;
+    R ra = a.wrapped();
+    return (R) detail::insn::i_permute_var(uint64<N>(ra), idx);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,129 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/scatter.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of a vector to the locations @a base[idx[i]]. The
+    elements are stored in order, thus if several indices are equal, the
+    location receives the last of the corresponding elements. The elements of
+    @a idx are signed 32-bit indices, thus unsigned indices must not exceed
+    2^31-1.
+
+    @code
+    base[idx0] = a0
+    ...
+    base[idxN] = aN
+    @endcode
+
+    Vectors of 64-bit elements must contain at least 4 elements, as the index
+    vector has half the size of the stored vector.
+
+    Implemented natively on AVX512F (AVX512VL for 128-bit and 256-bit
+    vectors). On other instruction sets the elements are stored one by one.
+*/
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter(T* base, const any_int32<N,I>& idx, const any_int32<N,V>& a)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> ra;
+    ra = a.wrapped();
+    detail::insn::i_scatter(reinterpret_cast<char*>(base), ridx, ra);
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter(T* base, const any_int32<N,I>& idx, const any_int64<N,V>& a)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> ra;
+    ra = a.wrapped();
+    detail::insn::i_scatter(reinterpret_cast<char*>(base), ridx, ra);
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter(T* base, const any_int32<N,I>& idx, const any_float32<N,V>& a)
+{
+    uint32<N> ridx = idx.wrapped();
+    float32<N> fa = a.wrapped();
+    uint32<N> ra = bit_cast<uint32<N>>(fa);
+    detail::insn::i_scatter(reinterpret_cast<char*>(base), ridx, ra);
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter(T* base, const any_int32<N,I>& idx, const any_float64<N,V>& a)
+{
+    uint32<N> ridx = idx.wrapped();
+    float64<N> fa = a.wrapped();
+    uint64<N> ra = bit_cast<uint64<N>>(fa);
+    detail::insn::i_scatter(reinterpret_cast<char*>(base), ridx, ra);
+}
+
+/** Stores the elements of a vector that are selected by @a mask to the
+    locations @a base[idx[i]]. The locations that correspond to elements that
+    are not selected are not accessed.
+
+    @code
+    if (mask0) base[idx0] = a0
+    ...
+    if (maskN) base[idxN] = aN
+    @endcode
+
+    See scatter() for further details.
+*/
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,I>& idx, const any_int32<N,V>& a,
+                    const mask_int32<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint32<N> ra;
+    ra = a.wrapped();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base), ridx, ra,
+                                   mask);
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,I>& idx, const any_int64<N,V>& a,
+                    const mask_int64<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    uint64<N> ra;
+    ra = a.wrapped();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base), ridx, ra,
+                                   mask);
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,I>& idx, const any_float32<N,V>& a,
+                    const mask_float32<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    float32<N> fa = a.wrapped();
+    uint32<N> ra = bit_cast<uint32<N>>(fa);
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base), ridx, ra,
+                                   bit_cast<mask_int32<N>>(mask));
+}
+template<class T, unsigned N, class I, class V> SIMDPP_INL
+void scatter_masked(T* base, const any_int32<N,I>& idx, const any_float64<N,V>& a,
+                    const mask_float64<N>& mask)
+{
+    uint32<N> ridx = idx.wrapped();
+    float64<N> fa = a.wrapped();
+    uint64<N> ra = bit_cast<uint64<N>>(fa);
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(base), ridx, ra,
+                                   bit_cast<mask_int64<N>>(mask));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
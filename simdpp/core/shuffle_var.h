@@ -0,0 +1,80 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SHUFFLE_VAR_H
+#define LIBSIMDPP_SIMDPP_CORE_SHUFFLE_VAR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/insn/shuffle_var.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Selects elements from two vectors according to a vector of indices. The
+    two vectors form a table of 2N elements, where the elements of @a a come
+    first. Each element of @a idx defines which element of the table to
+    select. The index is taken modulo 2N.
+
+    @code
+    r0 = idx0 % 2N < N ? a[idx0 % 2N] : b[idx0 % 2N - N]
+    ...
+    rN = idxN % 2N < N ? a[idxN % 2N] : b[idxN % 2N - N]
+    @endcode
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::type
+    shuffle_var(const any_vec8<N,V1>& a, const any_vec8<N,V2>& b,
+                const uint8<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V1>::type;
+    R ra = a.wrapped();
+    typename detail::get_expr_nomask<V2>::type rb = b.wrapped();
+    return (R) detail::insn::i_shuffle_var(uint8<N>(ra), uint8<N>(rb), idx);
+}
+
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::type
+    shuffle_var(const any_vec16<N,V1>& a, const any_vec16<N,V2>& b,
+                const uint16<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V1>::type;
+    R ra = a.wrapped();
+    typename detail::get_expr_nomask<V2>::type rb = b.wrapped();
+    return (R) detail::insn::i_shuffle_var(uint16<N>(ra), uint16<N>(rb), idx);
+}
+
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::type
+    shuffle_var(const any_vec32<N,V1>& a, const any_vec32<N,V2>& b,
+                const uint32<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V1>::type;
+    R ra = a.wrapped();
+    typename detail::get_expr_nomask<V2>::type rb = b.wrapped();
+    return (R) detail::insn::i_shuffle_var(uint32<N>(ra), uint32<N>(rb), idx);
+}
+
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::type
+    shuffle_var(const any_vec64<N,V1>& a, const any_vec64<N,V2>& b,
+                const uint64<N>& idx)
+{
+    using R = typename detail::get_expr_nomask<V1>::type;
+    R ra = a.wrapped();
+    typename detail::get_expr_nomask<V2>::type rb = b.wrapped();
+    return (R) detail::insn::i_shuffle_var(uint64<N>(ra), uint64<N>(rb), idx);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,73 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_BE_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_BE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/i_bswap.h>
+#include <simdpp/core/store_u.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores a vector of 16-bit, 32-bit or 64-bit integers to an unaligned memory
+    location in big-endian byte order.
+
+    @code
+    p[0] = to_big_endian(a0)
+    ...
+    p[N] = to_big_endian(aN)
+    @endcode
+
+    @a p must be aligned to the element size.
+
+    On little-endian architectures, this function is equivalent to
+    store_u(p, bswap(a)), otherwise to store_u(p, a).
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+void store_be(T* p, const any_int16<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Masks can not be stored");
+    uint16<N> r = a.wrapped();
+#if !SIMDPP_BIG_ENDIAN
+    r = bswap(r);
+#endif
+    store_u(p, r);
+}
+
+template<class T, unsigned N, class V> SIMDPP_INL
+void store_be(T* p, const any_int32<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Masks can not be stored");
+    uint32<N> r = a.wrapped();
+#if !SIMDPP_BIG_ENDIAN
+    r = bswap(r);
+#endif
+    store_u(p, r);
+}
+
+template<class T, unsigned N, class V> SIMDPP_INL
+void store_be(T* p, const any_int64<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Masks can not be stored");
+    uint64<N> r = a.wrapped();
+#if !SIMDPP_BIG_ENDIAN
+    r = bswap(r);
+#endif
+    store_u(p, r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
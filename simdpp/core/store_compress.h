@@ -0,0 +1,85 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/store_compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of a vector that are selected by @a mask to
+    consecutive locations in memory starting at @a p. The relative order of
+    the elements is preserved. Returns the number of stored elements.
+
+    The memory range of the whole vector starting at @a p may be written to.
+    The contents of the memory past the stored elements are unspecified
+    afterwards.
+
+    The pointer does not need to be aligned.
+
+    Implemented natively for 32-bit and 64-bit elements on AVX512F (AVX512VL
+    for 128-bit and 256-bit vectors). Elsewhere the elements are packed using
+    a lookup table of byte permutations. On SSE2-SSE3 the elements are stored
+    one by one.
+*/
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_int8<N,V>& a, const mask_int8<N>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped();
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, mask);
+}
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_int16<N,V>& a, const mask_int16<N>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped();
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, mask);
+}
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_int32<N,V>& a, const mask_int32<N>& mask)
+{
+    uint32<N> ra;
+    ra = a.wrapped();
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, mask);
+}
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_int64<N,V>& a, const mask_int64<N>& mask)
+{
+    uint64<N> ra;
+    ra = a.wrapped();
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, mask);
+}
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_float32<N,V>& a, const mask_float32<N>& mask)
+{
+    float32<N> fa = a.wrapped();
+    uint32<N> ra = bit_cast<uint32<N>>(fa);
+    mask_int32<N> rmask = bit_cast<mask_int32<N>>(mask);
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, rmask);
+}
+template<class T, unsigned N, class V> SIMDPP_INL
+unsigned store_compress(T* p, const any_float64<N,V>& a, const mask_float64<N>& mask)
+{
+    float64<N> fa = a.wrapped();
+    uint64<N> ra = bit_cast<uint64<N>>(fa);
+    mask_int64<N> rmask = bit_cast<mask_int64<N>>(mask);
+    return detail::insn::i_store_compress(reinterpret_cast<char*>(p), ra, rmask);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
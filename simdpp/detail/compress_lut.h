@@ -0,0 +1,117 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_COMPRESS_LUT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_COMPRESS_LUT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/align.h>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  For each combination of selected lanes of a vector of @a L elements of
+    @a E bytes each, contains byte indices that move the selected lanes to the
+    beginning of the vector. The relative order of the selected lanes is kept.
+    The indices of the remaining bytes are unspecified.
+*/
+template<unsigned L, unsigned E>
+struct compress_lut {
+    SIMDPP_ALIGN(16) std::uint8_t idx[1 << L][L * E];
+
+    static const compress_lut& get()
+    {
+        static const compress_lut lut;
+        return lut;
+    }
+
+private:
+    compress_lut()
+    {
+        for (unsigned m = 0; m < (1u << L); ++m) {
+            unsigned pos = 0;
+            for (unsigned i = 0; i < L; ++i) {
+                if (m & (1 << i)) {
+                    for (unsigned b = 0; b < E; ++b) {
+                        idx[m][pos * E + b] = i * E + b;
+                    }
+                    pos++;
+                }
+            }
+            for (; pos < L; ++pos) {
+                for (unsigned b = 0; b < E; ++b) {
+                    idx[m][pos * E + b] = 0;
+                }
+            }
+        }
+    }
+};
+
+/*  For each combination of selected lanes of a vector of @a L elements of
+    @a E bytes each, contains byte indices that move the consecutive elements
+    at the beginning of the vector to the selected lanes. The bytes of the
+    lanes that are not selected have the index 0x80, which selects zero in
+    permute_zbytes16().
+*/
+template<unsigned L, unsigned E>
+struct expand_lut {
+    SIMDPP_ALIGN(16) std::uint8_t idx[1 << L][L * E];
+
+    static const expand_lut& get()
+    {
+        static const expand_lut lut;
+        return lut;
+    }
+
+private:
+    expand_lut()
+    {
+        for (unsigned m = 0; m < (1u << L); ++m) {
+            unsigned pos = 0;
+            for (unsigned i = 0; i < L; ++i) {
+                bool selected = (m & (1 << i)) != 0;
+                for (unsigned b = 0; b < E; ++b) {
+                    idx[m][i * E + b] = selected ? pos * E + b : 0x80;
+                }
+                if (selected) {
+                    pos++;
+                }
+            }
+        }
+    }
+};
+
+// Returns the number of lanes selected by @a bits
+static SIMDPP_INL unsigned compress_count(std::uint32_t bits)
+{
+#if SIMDPP_USE_X86_POPCNT_INSN
+    return _mm_popcnt_u32(bits);
+#else
+    bits = bits - ((bits >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f;
+    return (bits * 0x01010101) >> 24;
+#endif
+}
+
+// Converts a bitmask of 64-bit lanes to a bitmask of 32-bit lanes
+static SIMDPP_INL unsigned compress_bits64_to_32(unsigned bits)
+{
+    return ((bits & 1) * 3) | ((bits & 2) * 6) | ((bits & 4) * 12) | ((bits & 8) * 24);
+}
+
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
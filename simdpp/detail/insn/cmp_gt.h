@@ -288,6 +288,26 @@ mask_int32<16> i_cmp_gt(const uint32<16>& a, const uint32<16>& b)
 
 // -----------------------------------------------------------------------------
 
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_AVX2
+/*  Emulates signed 64-bit greater-than comparison using 32-bit comparisons,
+    as pcmpgtq is not available before SSE4.2. The high halves decide the
+    result unless they are equal, in which case the low halves are compared as
+    unsigned numbers.
+*/
+static SIMDPP_INL
+__m128i i_emul_cmpgt_epi64(__m128i a, __m128i b)
+{
+    // flip the sign bits of the low halves to compare them as unsigned
+    __m128i bias = _mm_set_epi32(0, 0x80000000, 0, 0x80000000);
+    __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    __m128i gt_lo = _mm_shuffle_epi32(gt, _MM_SHUFFLE(2,2,0,0));
+    __m128i r = _mm_or_si128(gt, _mm_and_si128(eq, gt_lo));
+    // broadcast the result from the high halves
+    return _mm_shuffle_epi32(r, _MM_SHUFFLE(3,3,1,1));
+}
+#endif
+
 static SIMDPP_INL
 mask_int64x2 i_cmp_gt(const int64x2& a, const int64x2& b)
 {
@@ -297,6 +317,8 @@ mask_int64x2 i_cmp_gt(const int64x2& a, const int64x2& b)
     return _mm_comgt_epi64(a.native(), b.native());
 #elif SIMDPP_USE_AVX2
     return _mm_cmpgt_epi64(a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    return i_emul_cmpgt_epi64(a.native(), b.native());
 #elif SIMDPP_USE_NEON64
     return vcgtq_s64(a.native(), b.native());
 #elif SIMDPP_USE_VSX_207
@@ -344,6 +366,10 @@ mask_int64x2 i_cmp_gt(const uint64x2& a, const uint64x2& b)
     uint64<2> ca = bit_xor(a, 0x8000000000000000); // sub
     uint64<2> cb = bit_xor(b, 0x8000000000000000); // sub
     return _mm_cmpgt_epi64(ca.native(), cb.native());
+#elif SIMDPP_USE_SSE2
+    uint64<2> ca = bit_xor(a, 0x8000000000000000); // sub
+    uint64<2> cb = bit_xor(b, 0x8000000000000000); // sub
+    return i_emul_cmpgt_epi64(ca.native(), cb.native());
 #elif SIMDPP_USE_NEON64
     return vcgtq_u64(a.native(), b.native());
 #elif SIMDPP_USE_VSX_207
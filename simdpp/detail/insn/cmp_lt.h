@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/bit_xor.h>
+#include <simdpp/detail/insn/cmp_gt.h>
 #include <simdpp/detail/null/compare.h>
 #include <simdpp/detail/not_implemented.h>
 #include <simdpp/detail/vector_array_macros.h>
@@ -294,6 +295,8 @@ mask_int64x2 i_cmp_lt(const int64x2& a, const int64x2& b)
     return _mm_cmplt_epi64_mask(a.native(), b.native());
 #elif SIMDPP_USE_AVX2
     return _mm_cmpgt_epi64(b.native(), a.native());
+#elif SIMDPP_USE_SSE2
+    return i_emul_cmpgt_epi64(b.native(), a.native());
 #elif SIMDPP_USE_NEON64
     return vcltq_s64(a.native(), b.native());
 #elif SIMDPP_USE_VSX_207
@@ -340,6 +343,10 @@ mask_int64x2 i_cmp_lt(const uint64x2& a, const uint64x2& b)
     uint64<2> ca = bit_xor(a, 0x8000000000000000); // sub
     uint64<2> cb = bit_xor(b, 0x8000000000000000); // sub
     return _mm_cmpgt_epi64(cb.native(), ca.native());
+#elif SIMDPP_USE_SSE2
+    uint64<2> ca = bit_xor(a, 0x8000000000000000); // sub
+    uint64<2> cb = bit_xor(b, 0x8000000000000000); // sub
+    return i_emul_cmpgt_epi64(cb.native(), ca.native());
 #elif SIMDPP_USE_NEON64
     return vcltq_u64(a.native(), b.native());
 #elif SIMDPP_USE_VSX_207
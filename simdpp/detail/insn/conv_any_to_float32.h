@@ -69,7 +69,7 @@ static SIMDPP_INL
 float32<8> i_to_float32(const float64<8>& a)
 {
 #if SIMDPP_USE_AVX512F
-    return _mm512_cvt_roundpd_ps(a.native(), (_MM_FROUND_TO_ZERO |_MM_FROUND_NO_EXC));
+    return _mm512_cvtpd_ps(a.native());
 #else
     float32x4 r1, r2;
     r1 = i_to_float32(a.vec<0>());
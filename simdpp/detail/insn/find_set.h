@@ -0,0 +1,127 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_FIND_SET_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_FIND_SET_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/extract_bits.h>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Returns the index of the lowest set bit or -1 if no bits are set
+static SIMDPP_INL
+int bits_find_first_set(uint64_t bits)
+{
+    if (bits == 0) {
+        return -1;
+    }
+#if __GNUC__
+    return __builtin_ctzll(bits);
+#else
+    int r = 0;
+    for (; (bits & 1) == 0; bits >>= 1) {
+        r++;
+    }
+    return r;
+#endif
+}
+
+// Returns the index of the highest set bit or -1 if no bits are set
+static SIMDPP_INL
+int bits_find_last_set(uint64_t bits)
+{
+    if (bits == 0) {
+        return -1;
+    }
+#if __GNUC__
+    return 63 - __builtin_clzll(bits);
+#else
+    int r = -1;
+    for (; bits != 0; bits >>= 1) {
+        r++;
+    }
+    return r;
+#endif
+}
+
+/*  Returns a bit mask with bit i set if element i of the given native vector
+    is set. 512-bit vectors use the AVX-512 mask registers, the rest rely on
+    extract_bits.
+*/
+template<class V> SIMDPP_INL
+uint64_t i_find_set_bits(const V& a)
+{
+    return i_extract_bits_any(a);
+}
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint64_t i_find_set_bits(const uint8<64>& a)
+{
+    return _mm512_test_epi8_mask(a.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64_t i_find_set_bits(const uint16<32>& a)
+{
+    return _mm512_test_epi16_mask(a.native(), a.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64_t i_find_set_bits(const uint32<16>& a)
+{
+    return _mm512_test_epi32_mask(a.native(), a.native());
+}
+
+static SIMDPP_INL
+uint64_t i_find_set_bits(const uint64<8>& a)
+{
+    return _mm512_test_epi64_mask(a.native(), a.native());
+}
+#endif
+
+template<class V> SIMDPP_INL
+int i_find_first_set(const V& a)
+{
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        int i = bits_find_first_set(i_find_set_bits(a.vec(j)));
+        if (i >= 0) {
+            return j * V::base_length + i;
+        }
+    }
+    return -1;
+}
+
+template<class V> SIMDPP_INL
+int i_find_last_set(const V& a)
+{
+    for (unsigned j = V::vec_length; j-- > 0;) {
+        int i = bits_find_last_set(i_find_set_bits(a.vec(j)));
+        if (i >= 0) {
+            return j * V::base_length + i;
+        }
+    }
+    return -1;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
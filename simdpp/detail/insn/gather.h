@@ -0,0 +1,266 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <cstddef>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Loads the elements of @a r from @a base indexed by @a idx. If @a mask is
+    not null, only the elements whose mask element is nonzero are loaded and
+    the rest are set to zero.
+*/
+template<class V> SIMDPP_INL
+void i_gather_scalar(V& r, const char* base, const int32_t* idx,
+                     const V* mask = nullptr)
+{
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+    SIMDPP_ALIGN(64) E mask_data[V::length];
+    if (mask) {
+        store(mask_data, *mask);
+    }
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (mask && mask_data[i] == 0) {
+            data[i] = 0;
+        } else {
+            std::memcpy(&data[i], base + std::ptrdiff_t(idx[i]) * sizeof(E), sizeof(E));
+        }
+    }
+    r = load(data);
+}
+
+template<class V> SIMDPP_INL
+void i_gather_scalar(V& r, const char* base, const uint32<V::length>& idx)
+{
+    SIMDPP_ALIGN(64) int32_t idx_data[V::length];
+    store(idx_data, idx);
+    i_gather_scalar(r, base, idx_data);
+}
+
+template<class V, class M> SIMDPP_INL
+void i_gather_masked_scalar(V& r, const char* base, const uint32<V::length>& idx,
+                            const M& mask)
+{
+    SIMDPP_ALIGN(64) int32_t idx_data[V::length];
+    store(idx_data, idx);
+    V vmask = mask.unmask();
+    i_gather_scalar(r, base, idx_data, &vmask);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather(uint32<4>& r, const char* base, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    r = _mm_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+#else
+    i_gather_scalar(r, base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint32<8>& r, const char* base, const uint32<8>& idx)
+{
+    r = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint32<16>& r, const char* base, const uint32<16>& idx)
+{
+    r = _mm512_i32gather_epi32(idx.native(), base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_gather(uint32<N>& r, const char* base, const uint32<N>& idx)
+{
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        i_gather(r.vec(i), base, idx.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather(uint64<4>& r, const char* base, const uint32<4>& idx)
+{
+#if __INTEL_COMPILER
+    r = _mm256_i32gather_epi64(reinterpret_cast<const __int64*>(base), idx.native(), 8);
+#else
+    r = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(base), idx.native(), 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather(uint64<8>& r, const char* base, const uint32<8>& idx)
+{
+    r = _mm512_i32gather_epi64(idx.native(), base, 8);
+}
+#endif
+
+/*  The index vectors have half the size of the vectors of 64-bit elements,
+    thus each native index vector is split into two halves. Without native
+    gather instructions there's no index vector type matching the native
+    vector of 64-bit elements, thus the indices are accessed via memory.
+*/
+template<unsigned N> SIMDPP_INL
+void i_gather(uint64<N>& r, const char* base, const uint32<N>& idx)
+{
+#if SIMDPP_USE_AVX2
+    using I = typename uint32<N>::base_vector_type;
+    for (unsigned i = 0; i < idx.vec_length; ++i) {
+        uint32<I::length / 2> idx0, idx1;
+        split(idx.vec(i), idx0, idx1);
+        i_gather(r.vec(i*2), base, idx0);
+        i_gather(r.vec(i*2+1), base, idx1);
+    }
+#else
+    const unsigned veclen = uint64<N>::base_vector_type::length;
+    SIMDPP_ALIGN(64) int32_t idx_data[N];
+    store(idx_data, idx);
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        i_gather_scalar(r.vec(i), base, idx_data + i*veclen);
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_gather_masked(uint32<4>& r, const char* base, const uint32<4>& idx,
+                     const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm_mmask_i32gather_epi32(_mm_setzero_si128(), mask.native(),
+                                  idx.native(), base, 4);
+#elif SIMDPP_USE_AVX2
+    r = _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                 reinterpret_cast<const int*>(base),
+                                 idx.native(), mask.native(), 4);
+#else
+    i_gather_masked_scalar(r, base, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint32<8>& r, const char* base, const uint32<8>& idx,
+                     const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), mask.native(),
+                                     idx.native(), base, 4);
+#else
+    r = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                    reinterpret_cast<const int*>(base),
+                                    idx.native(), mask.native(), 4);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint32<16>& r, const char* base, const uint32<16>& idx,
+                     const mask_int32<16>& mask)
+{
+    r = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.native(),
+                                    idx.native(), base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_gather_masked(uint32<N>& r, const char* base, const uint32<N>& idx,
+                     const mask_int32<N>& mask)
+{
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        i_gather_masked(r.vec(i), base, idx.vec(i), mask.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_gather_masked(uint64<4>& r, const char* base, const uint32<4>& idx,
+                     const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_mmask_i32gather_epi64(_mm256_setzero_si256(), mask.native(),
+                                     idx.native(), base, 8);
+#elif __INTEL_COMPILER
+    r = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const __int64*>(base),
+                                    idx.native(), mask.native(), 8);
+#else
+    r = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const long long*>(base),
+                                    idx.native(), mask.native(), 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_gather_masked(uint64<8>& r, const char* base, const uint32<8>& idx,
+                     const mask_int64<8>& mask)
+{
+    r = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask.native(),
+                                    idx.native(), base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_gather_masked(uint64<N>& r, const char* base, const uint32<N>& idx,
+                     const mask_int64<N>& mask)
+{
+#if SIMDPP_USE_AVX2
+    using I = typename uint32<N>::base_vector_type;
+    for (unsigned i = 0; i < idx.vec_length; ++i) {
+        uint32<I::length / 2> idx0, idx1;
+        split(idx.vec(i), idx0, idx1);
+        i_gather_masked(r.vec(i*2), base, idx0, mask.vec(i*2));
+        i_gather_masked(r.vec(i*2+1), base, idx1, mask.vec(i*2+1));
+    }
+#else
+    const unsigned veclen = uint64<N>::base_vector_type::length;
+    SIMDPP_ALIGN(64) int32_t idx_data[N];
+    store(idx_data, idx);
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        typename uint64<N>::base_vector_type vmask = mask.vec(i).unmask();
+        i_gather_scalar(r.vec(i), base, idx_data + i*veclen, &vmask);
+    }
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
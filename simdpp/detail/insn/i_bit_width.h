@@ -0,0 +1,207 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BIT_WIDTH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BIT_WIDTH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/detail/null/bitwise.h>
+#include <simdpp/detail/width.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes the bit width by converting the value to float and extracting the
+    exponent. Clearing the bit below the leading one ensures that the
+    conversion can't round the value up to the next power of two.
+*/
+template<class V> SIMDPP_INL
+V v_emul_bit_width_u32(const V& a)
+{
+    using w_i32 = typename same_width<V>::i32;
+    using w_i16 = typename same_width<V>::i16;
+    using w_u16 = typename same_width<V>::u16;
+
+    V x = bit_andnot(a, shift_r<1>(a));
+    V e = shift_r<23>(bit_cast<V>(to_float32(w_i32(x))));
+
+    // The biased exponent of 1 is 127 and zero has zero exponent. Values with
+    // the highest bit set convert to negative numbers and produce 256 or more
+    // because of the sign bit. 16-bit saturating subtraction and minimum fix
+    // up both cases, the upper halves of the elements stay zero.
+    w_u16 bias = splat(126);
+    w_i16 max_width = splat(32);
+    w_u16 r = sub_sat(w_u16(e), bias);
+    r = min(w_i16(r), max_width);
+    return V(r);
+}
+
+static SIMDPP_INL
+uint32<4> i_bit_width(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_bit_width32(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    uint32<4> width = splat(32);
+    return sub(width, uint32<4>(_mm_lzcnt_epi32(a.native())));
+#elif SIMDPP_USE_NEON
+    uint32<4> width = splat(32);
+    return sub(width, uint32<4>(vclzq_u32(a.native())));
+#elif SIMDPP_USE_VSX_207
+    uint32<4> width = splat(32);
+    return sub(width, uint32<4>(vec_cntlz(a.native())));
+#elif SIMDPP_USE_MSA
+    uint32<4> width = splat(32);
+    return sub(width, uint32<4>((v4u32) __msa_nlzc_w((v4i32) a.native())));
+#else
+    return v_emul_bit_width_u32(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_bit_width(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    uint32<8> width = splat(32);
+    return sub(width, uint32<8>(_mm256_lzcnt_epi32(a.native())));
+#else
+    return v_emul_bit_width_u32(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_bit_width(const uint32<16>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    uint32<16> width = splat(32);
+    return sub(width, uint32<16>(_mm512_lzcnt_epi32(a.native())));
+#else
+    // the conversion is unsigned, thus the highest bit needs no special case
+    uint32<16> x = bit_andnot(a, shift_r<1>(a));
+    uint32<16> e = _mm512_castps_si512(_mm512_cvtepu32_ps(x.native()));
+    int32<16> bias = splat(126);
+    int32<16> r = sub(int32<16>(shift_r<23>(e)), bias);
+    return _mm512_max_epi32(r.native(), _mm512_setzero_si512());
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  Computes the bit widths of both 32-bit halves of each element and selects
+    the width of the high half plus 32 if it's nonzero or the width of the low
+    half otherwise.
+*/
+template<class V> SIMDPP_INL
+V v_emul_bit_width_u64(const V& a)
+{
+    using w_u32 = typename same_width<V>::u32;
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSE4_1
+    // 32-bit minimum and maximum are not available
+    using w_iN = typename same_width<V>::i16;
+#else
+    using w_iN = typename same_width<V>::i32;
+#endif
+
+    V w = V(i_bit_width(w_u32(a)));
+    V lo_mask = splat(0x00000000ffffffff);
+    w_iN lo = w_iN(bit_and(w, lo_mask));
+    w_iN hi = w_iN(shift_r<32>(w));
+    w_iN one = splat(1);
+
+    hi = add(hi, shift_l<5>(min(hi, one)));
+    return V(max(hi, lo));
+}
+
+static SIMDPP_INL
+uint64<2> i_bit_width(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_bit_width64(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    uint64<2> width = splat(64);
+    return sub(width, uint64<2>(_mm_lzcnt_epi64(a.native())));
+#elif SIMDPP_USE_VSX_207
+    uint64<2> width = splat(64);
+    return sub(width, uint64<2>(vec_cntlz(a.native())));
+#elif SIMDPP_USE_MSA
+    uint64<2> width = splat(64);
+    return sub(width, uint64<2>((v2u64) __msa_nlzc_d((v2i64) a.native())));
+#else
+    return v_emul_bit_width_u64(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_bit_width(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    uint64<4> width = splat(64);
+    return sub(width, uint64<4>(_mm256_lzcnt_epi64(a.native())));
+#else
+    return v_emul_bit_width_u64(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_bit_width(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    uint64<8> width = splat(64);
+    return sub(width, uint64<8>(_mm512_lzcnt_epi64(a.native())));
+#else
+    return v_emul_bit_width_u64(a);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_bit_width(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, i_bit_width, a)
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,170 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BSWAP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_BSWAP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/detail/shuffle/shuffle_mask.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned N> SIMDPP_INL
+uint16<N> v_bswap_using_permute(const uint16<N>& a)
+{
+    uint8<N*2> mask = make_uint(1, 0, 3, 2, 5, 4, 7, 6,
+                                9, 8, 11, 10, 13, 12, 15, 14);
+    return uint16<N>(permute_bytes16(uint8<N*2>(a), mask));
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_bswap_using_permute(const uint32<N>& a)
+{
+    uint8<N*4> mask = make_uint(3, 2, 1, 0, 7, 6, 5, 4,
+                                11, 10, 9, 8, 15, 14, 13, 12);
+    return uint32<N>(permute_bytes16(uint8<N*4>(a), mask));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_bswap_using_permute(const uint64<N>& a)
+{
+    uint8<N*8> mask = make_uint(7, 6, 5, 4, 3, 2, 1, 0,
+                                15, 14, 13, 12, 11, 10, 9, 8);
+    return uint64<N>(permute_bytes16(uint8<N*8>(a), mask));
+}
+
+#if SIMDPP_USE_SSE2
+// SSE2 has no byte shuffle. The 16-bit elements are reversed using the word
+// shuffles and the bytes within them are swapped using shifts.
+static SIMDPP_INL
+__m128i sse_bswap_bytes_in_16(__m128i a)
+{
+    return _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_bswap(const uint16<8>& a)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    return sse_bswap_bytes_in_16(a.native());
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(a.native())));
+#else
+    return v_bswap_using_permute(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_bswap(const uint16<16>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_bswap(const uint16<32>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_bswap(const uint32<4>& a)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    const int mask = SIMDPP_SHUFFLE_MASK_4x4(1, 0, 3, 2);
+    __m128i r = _mm_shufflelo_epi16(a.native(), mask);
+    r = _mm_shufflehi_epi16(r, mask);
+    return sse_bswap_bytes_in_16(r);
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(a.native())));
+#else
+    return v_bswap_using_permute(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_bswap(const uint32<8>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_bswap(const uint32<16>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_bswap(const uint64<2>& a)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    const int mask = SIMDPP_SHUFFLE_MASK_4x4(3, 2, 1, 0);
+    __m128i r = _mm_shufflelo_epi16(a.native(), mask);
+    r = _mm_shufflehi_epi16(r, mask);
+    return sse_bswap_bytes_in_16(r);
+#elif SIMDPP_USE_NEON
+    return vreinterpretq_u64_u8(vrev64q_u8(vreinterpretq_u8_u64(a.native())));
+#else
+    return v_bswap_using_permute(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_bswap(const uint64<4>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_bswap(const uint64<8>& a)
+{
+    return v_bswap_using_permute(a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_bswap(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, i_bswap, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,287 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_neg.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int16.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The division uses the method described by Granlund and Montgomery in
+    "Division by Invariant Integers using Multiplication". For unsigned
+    N-bit divisors d, l = ceil(log2(d)) and
+
+        m = floor(2^N * (2^l - d) / d) + 1
+        t = mul_hi(n, m)
+        q = (t + ((n - t) >> min(l, 1))) >> max(l - 1, 0)
+
+    For signed divisors, l = max(ceil(log2(|d|)), 1) and
+
+        m = floor(2^(N + l - 1) / |d|) + 1 - 2^N
+        q = (n + mul_hi(n, m)) >> (l - 1)
+        q = q - (n >> (N - 1))
+
+    which is then negated if d is negative. m fits into N bits in both cases,
+    thus each division needs a single high-half multiplication.
+*/
+
+// Returns ceil(log2(d)) for d > 0
+static SIMDPP_INL
+unsigned div_ceil_log2(uint64_t d)
+{
+    unsigned r = 0;
+    for (uint64_t v = d - 1; v != 0; v >>= 1) {
+        r++;
+    }
+    return r;
+}
+
+// Returns floor((hi * 2^64 + lo) / d). hi must be less than d.
+static SIMDPP_INL
+uint64_t div_wide_u64(uint64_t hi, uint64_t lo, uint64_t d)
+{
+    uint64_t q = 0;
+    for (unsigned i = 0; i < 64; ++i) {
+        bool carry = (hi >> 63) != 0;
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+        q <<= 1;
+        if (carry || hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    return q;
+}
+
+/*  Computes the magic number and the shift amounts for an unsigned divisor
+    @a d of @a bits bits. The magic number is returned as the low @a bits bits
+    of the result.
+*/
+static SIMDPP_INL
+uint64_t div_magic_unsigned(uint64_t d, unsigned bits,
+                            unsigned& pre_shift, unsigned& post_shift)
+{
+    unsigned l = div_ceil_log2(d);
+    pre_shift = l < 1 ? l : 1;
+    post_shift = l > 1 ? l - 1 : 0;
+
+    if (bits < 64) {
+        uint64_t p = (uint64_t(1) << l) - d;
+        return (p << bits) / d + 1;
+    }
+    // 2^64 wraps to zero
+    uint64_t p = (l < 64 ? uint64_t(1) << l : 0) - d;
+    return div_wide_u64(p, 0, d) + 1;
+}
+
+/*  Computes the magic number and the shift amount for a signed divisor whose
+    absolute value is @a ad. The magic number is returned as the low @a bits
+    bits of the result.
+*/
+static SIMDPP_INL
+uint64_t div_magic_signed(uint64_t ad, unsigned bits, unsigned& post_shift)
+{
+    unsigned l = div_ceil_log2(ad);
+    l = l < 1 ? 1 : l;
+    post_shift = l - 1;
+
+    if (bits < 64) {
+        uint64_t p = (uint64_t(1) << (bits + l - 1)) / ad;
+        return p + 1 - (uint64_t(1) << bits);
+    }
+    if (ad == 1) {
+        return 1;
+    }
+    // 2^64 is subtracted by the wraparound
+    return div_wide_u64(uint64_t(1) << (l - 1), 0, ad) + 1;
+}
+
+namespace null {
+
+template<class T> SIMDPP_INL
+T el_div(T a, T d)
+{
+    // avoid the overflow of the most negative value divided by -1
+    if (std::is_signed<T>::value && d == T(-1)) {
+        return T(0 - typename std::make_unsigned<T>::type(a));
+    }
+    return T(a / d);
+}
+
+template<class T> SIMDPP_INL
+T el_mod(T a, T d)
+{
+    using U = typename std::make_unsigned<T>::type;
+    return T(U(a) - U(el_div(a, d)) * U(d));
+}
+
+} // namespace null
+
+namespace insn {
+
+template<class V, class D> SIMDPP_INL
+V v_div_unsigned(const V& a, const D& d)
+{
+    V m = splat(d.magic());
+    V t = mul_hi(a, m);
+    V q = sub(a, t);
+    q = shift_r(q, d.pre_shift());
+    q = add(q, t);
+    return shift_r(q, d.post_shift());
+}
+
+template<class V, class D> SIMDPP_INL
+V v_div_signed(const V& a, const D& d)
+{
+    const unsigned sign_shift = sizeof(typename V::element_type) * 8 - 1;
+    V m = splat(d.magic());
+    V q = add(a, mul_hi(a, m));
+    q = shift_r(q, d.post_shift());
+    q = sub(q, shift_r(a, sign_shift));
+    if (d.divisor() < 0) {
+        q = neg(q);
+    }
+    return q;
+}
+
+// 8-bit multiplication is not available, thus the division of 8-bit elements
+// is done on 16-bit elements. The product of two 8-bit values fits in 16 bits.
+template<unsigned N, class D> SIMDPP_INL
+uint16<N> v_div_u8_wide(const uint16<N>& a, const D& d)
+{
+    uint16<N> m = splat(uint16_t(d.magic()));
+    uint16<N> t = mul_lo(a, m);
+    t = shift_r<8>(t);
+    uint16<N> q = sub(a, t);
+    q = shift_r(q, d.pre_shift());
+    q = add(q, t);
+    return shift_r(q, d.post_shift());
+}
+
+template<unsigned N, class D> SIMDPP_INL
+int16<N> v_div_i8_wide(const int16<N>& a, const D& d)
+{
+    int16<N> m = splat(int16_t(d.magic()));
+    int16<N> t = mul_lo(a, m);
+    int16<N> q = add(a, shift_r<8>(t));
+    q = shift_r(q, d.post_shift());
+    q = sub(q, shift_r<15>(a));
+    if (d.divisor() < 0) {
+        q = neg(q);
+    }
+    return q;
+}
+
+template<unsigned N, class D> SIMDPP_INL
+uint8<N> v_div(const uint8<N>& a, const D& d)
+{
+    return to_uint8(v_div_u8_wide(to_uint16(a), d));
+}
+
+template<unsigned N, class D> SIMDPP_INL
+int8<N> v_div(const int8<N>& a, const D& d)
+{
+    return to_int8(v_div_i8_wide(to_int16(a), d));
+}
+
+template<unsigned N, class D> SIMDPP_INL
+uint16<N> v_div(const uint16<N>& a, const D& d) { return v_div_unsigned(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+int16<N> v_div(const int16<N>& a, const D& d) { return v_div_signed(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+uint32<N> v_div(const uint32<N>& a, const D& d) { return v_div_unsigned(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+int32<N> v_div(const int32<N>& a, const D& d) { return v_div_signed(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+uint64<N> v_div(const uint64<N>& a, const D& d) { return v_div_unsigned(a, d); }
+template<unsigned N, class D> SIMDPP_INL
+int64<N> v_div(const int64<N>& a, const D& d) { return v_div_signed(a, d); }
+
+template<unsigned N, class D> SIMDPP_INL
+uint8<N> v_mod(const uint8<N>& a, const D& d)
+{
+    uint16<N> a16 = to_uint16(a);
+    uint16<N> d16 = splat(uint16_t(d.divisor()));
+    uint16<N> q = v_div_u8_wide(a16, d);
+    uint16<N> r = sub(a16, mul_lo(q, d16));
+    return to_uint8(r);
+}
+
+template<unsigned N, class D> SIMDPP_INL
+int8<N> v_mod(const int8<N>& a, const D& d)
+{
+    int16<N> a16 = to_int16(a);
+    int16<N> d16 = splat(int16_t(d.divisor()));
+    int16<N> q = v_div_i8_wide(a16, d);
+    int16<N> r = sub(a16, mul_lo(q, d16));
+    return to_int8(r);
+}
+
+template<class V, class D> SIMDPP_INL
+V v_mod(const V& a, const D& d)
+{
+    V dv = splat(d.divisor());
+    V q = v_div(a, d);
+    return sub(a, V(mul_lo(q, dv)));
+}
+
+template<class V, class D> SIMDPP_INL
+V i_div(const V& a, const D& d)
+{
+#if SIMDPP_USE_NULL
+    V r;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        for (unsigned i = 0; i < a.base_length; ++i) {
+            r.vec(j).el(i) = null::el_div(a.vec(j).el(i), d.divisor());
+        }
+    }
+    return r;
+#else
+    return v_div(a, d);
+#endif
+}
+
+template<class V, class D> SIMDPP_INL
+V i_mod(const V& a, const D& d)
+{
+#if SIMDPP_USE_NULL
+    V r;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        for (unsigned i = 0; i < a.base_length; ++i) {
+            r.vec(j).el(i) = null::el_mod(a.vec(j).el(i), d.divisor());
+        }
+    }
+    return r;
+#else
+    return v_mod(a, d);
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
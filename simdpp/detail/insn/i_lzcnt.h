@@ -0,0 +1,330 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_LZCNT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_LZCNT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/detail/insn/i_bit_width.h>
+#include <simdpp/detail/insn/i_popcnt.h>
+#include <simdpp/detail/null/bitwise.h>
+#include <simdpp/detail/width.h>
+#include <simdpp/detail/vector_array_macros.h>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Sets all bits below the highest set bit of each element
+template<unsigned S>
+struct v_smear_r {
+    template<class V> static SIMDPP_INL
+    V run(const V& a)
+    {
+        V x = v_smear_r<S/2>::run(a);
+        return bit_or(x, shift_r<S>(x));
+    }
+};
+
+template<>
+struct v_smear_r<0> {
+    template<class V> static SIMDPP_INL
+    V run(const V& a) { return a; }
+};
+
+template<class V> SIMDPP_INL
+V v_emul_lzcnt_using_popcnt(const V& a)
+{
+    V x = v_smear_r<V::num_bits/2>::run(a);
+    return i_popcnt(V(bit_not(x)));
+}
+
+/*  Looks up the leading zero counts of both nibbles of each byte. The table
+    for the high nibble produces a value larger than any result of the table
+    for the low nibble when the high nibble is zero, thus the minimum of the
+    two lookups is the result.
+*/
+template<class V> SIMDPP_INL
+V v_emul_lzcnt_u8(const V& a)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    V lut_hi = make_uint(8, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+    V lut_lo = make_uint(8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4);
+    V mask = splat(0x0f);
+    V hi = permute_bytes16(lut_hi, V(shift_r<4>(a)));
+    V lo = permute_bytes16(lut_lo, V(bit_and(a, mask)));
+    return min(hi, lo);
+#else
+    return v_emul_lzcnt_using_popcnt(a);
+#endif
+}
+
+// Combines the leading zero counts of both bytes of each element. The count
+// of the low byte is added only if the high byte is zero.
+template<class V> SIMDPP_INL
+V v_emul_lzcnt_u16(const V& a)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_ALTIVEC
+    using w_u8 = typename same_width<V>::u8;
+
+    V l8 = V(v_emul_lzcnt_u8(w_u8(a)));
+    V lo_mask = splat(0x00ff);
+    V eight = splat(8);
+    V hi = shift_r<8>(l8);
+    V lo = bit_and(l8, lo_mask);
+    return add(hi, V(bit_and(lo, cmp_eq(hi, eight))));
+#else
+    return v_emul_lzcnt_using_popcnt(a);
+#endif
+}
+
+static SIMDPP_INL
+uint8<16> i_lzcnt(const uint8<16>& a)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_lzcnt(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vclzq_u8(a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#elif SIMDPP_USE_MSA
+    return (v16u8) __msa_nlzc_b((v16i8) a.native());
+#else
+    return v_emul_lzcnt_u8(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_lzcnt(const uint8<32>& a)
+{
+    return v_emul_lzcnt_u8(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_lzcnt(const uint8<64>& a)
+{
+    return v_emul_lzcnt_u8(a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_lzcnt(const uint16<8>& a)
+{
+#if SIMDPP_USE_NULL
+    uint16<8> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_lzcnt(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_NEON
+    return vclzq_u16(a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_nlzc_h((v8i16) a.native());
+#else
+    return v_emul_lzcnt_u16(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_lzcnt(const uint16<16>& a)
+{
+    return v_emul_lzcnt_u16(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_lzcnt(const uint16<32>& a)
+{
+    return v_emul_lzcnt_u16(a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_lzcnt(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_lzcnt(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_lzcnt_epi32(a.native());
+#elif SIMDPP_USE_NEON
+    return vclzq_u32(a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_nlzc_w((v4i32) a.native());
+#else
+    uint32<4> width = splat(32);
+    return sub(width, i_bit_width(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_lzcnt(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_lzcnt_epi32(a.native());
+#else
+    uint32<8> width = splat(32);
+    return sub(width, i_bit_width(a));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_lzcnt(const uint32<16>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_lzcnt_epi32(a.native());
+#else
+    uint32<16> width = splat(32);
+    return sub(width, i_bit_width(a));
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_lzcnt(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_lzcnt(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_lzcnt_epi64(a.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_cntlz(a.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_nlzc_d((v2i64) a.native());
+#else
+    uint64<2> width = splat(64);
+    return sub(width, i_bit_width(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_lzcnt(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_lzcnt_epi64(a.native());
+#else
+    uint64<4> width = splat(64);
+    return sub(width, i_bit_width(a));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_lzcnt(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_lzcnt_epi64(a.native());
+#else
+    uint64<8> width = splat(64);
+    return sub(width, i_bit_width(a));
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_lzcnt(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, i_lzcnt, a)
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The trailing zero count is computed from a value that has the trailing
+    zero bits of the element set and all other bits cleared. The population
+    count of that value is used unless the leading zero count of it is cheaper.
+*/
+template<class V>
+struct tzcnt_use_lzcnt {
+#if SIMDPP_USE_NEON
+    static const bool value = V::num_bits <= 32;
+#elif SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA || SIMDPP_USE_AVX512VPOPCNTDQ
+    static const bool value = false;
+#elif SIMDPP_USE_AVX512CD
+    static const bool value = V::num_bits >= 32;
+#else
+    static const bool value = false;
+#endif
+};
+
+template<class V> SIMDPP_INL
+V v_tzcnt_from_mask(const V& t, std::true_type)
+{
+    V width = splat(V::num_bits);
+    return sub(width, i_lzcnt(t));
+}
+
+template<class V> SIMDPP_INL
+V v_tzcnt_from_mask(const V& t, std::false_type)
+{
+    return i_popcnt(t);
+}
+
+template<class V> SIMDPP_INL
+V i_tzcnt(const V& a)
+{
+    V one = splat(1);
+    V t = bit_andnot(sub(a, one), a);
+    return v_tzcnt_from_mask(t, std::integral_constant<bool,
+                             tzcnt_use_lzcnt<V>::value>());
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -282,7 +282,7 @@ int64x2 i_max(const int64x2& a, const int64x2& b)
 {
 #if SIMDPP_USE_AVX512VL
     return _mm_max_epi64(a.native(), b.native());
-#elif SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     mask_int64x2 mask = cmp_gt(a, b);
     return blend(a, b, mask);
 #elif SIMDPP_USE_VSX_207
@@ -330,7 +330,7 @@ uint64x2 i_max(const uint64x2& a, const uint64x2& b)
 {
 #if SIMDPP_USE_AVX512VL
     return _mm_max_epu64(a.native(), b.native());
-#elif SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     mask_int64x2 mask = cmp_gt(a, b);
     return blend(a, b, mask);
 #elif SIMDPP_USE_VSX_207
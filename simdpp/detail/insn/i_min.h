@@ -283,7 +283,7 @@ int64x2 i_min(const int64x2& a, const int64x2& b)
 {
 #if SIMDPP_USE_AVX512VL
     return _mm_min_epi64(a.native(), b.native());
-#elif SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     mask_int64x2 mask = cmp_lt(a, b);
     return blend(a, b, mask);
 #elif SIMDPP_USE_VSX_207
@@ -331,7 +331,7 @@ uint64x2 i_min(const uint64x2& a, const uint64x2& b)
 {
 #if SIMDPP_USE_AVX512VL
     return _mm_min_epu64(a.native(), b.native());
-#elif SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     mask_int64x2 mask = cmp_lt(a, b);
     return blend(a, b, mask);
 #elif SIMDPP_USE_VSX_207
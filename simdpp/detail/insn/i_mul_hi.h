@@ -13,9 +13,18 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_mull.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/unzip_lo.h>
 #include <simdpp/core/unzip_hi.h>
 #include <simdpp/detail/null/math.h>
+#include <simdpp/detail/width.h>
 #include <simdpp/detail/vector_array_macros.h>
 
 namespace simdpp {
@@ -113,6 +122,293 @@ uint16<32> i_mul_hi(const uint16<32>& a, const uint16<32>& b)
 
 // -----------------------------------------------------------------------------
 
+static SIMDPP_INL
+uint32<4> i_mul_hi(const uint32<4>& a, const uint32<4>& b)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (uint64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    // multiply even and odd elements separately and merge the high halves
+    __m128i ev = _mm_mul_epu32(a.native(), b.native());
+    __m128i od = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    ev = _mm_srli_epi64(ev, 32);
+#if SIMDPP_USE_SSE4_1
+    return _mm_blend_epi16(ev, od, 0xcc);
+#else
+    uint32<4> mask = make_uint(0, 0xffffffff);
+    return _mm_or_si128(ev, _mm_and_si128(od, mask.native()));
+#endif
+#elif SIMDPP_USE_NEON
+    uint64x2 lo = vmull_u32(vget_low_u32(a.native()), vget_low_u32(b.native()));
+    uint64x2 hi = vmull_u32(vget_high_u32(a.native()), vget_high_u32(b.native()));
+    return unzip4_hi(uint32x4(lo), uint32x4(hi));
+#elif SIMDPP_BIG_ENDIAN
+    uint32<8> ab;
+    ab = mull(a, b);
+    return unzip4_lo(ab.vec<0>(), ab.vec<1>());
+#else
+    uint32<8> ab;
+    ab = mull(a, b);
+    return unzip4_hi(ab.vec<0>(), ab.vec<1>());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_mul_hi(const uint32<8>& a, const uint32<8>& b)
+{
+    __m256i ev = _mm256_mul_epu32(a.native(), b.native());
+    __m256i od = _mm256_mul_epu32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_mul_hi(const uint32<16>& a, const uint32<16>& b)
+{
+    __m512i ev = _mm512_mul_epu32(a.native(), b.native());
+    __m512i od = _mm512_mul_epu32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_blend_epi32(0xaaaa, ev, od);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int32<4> i_mul_hi(const int32<4>& a, const int32<4>& b)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (int64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    __m128i ev = _mm_mul_epi32(a.native(), b.native());
+    __m128i od = _mm_mul_epi32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    ev = _mm_srli_epi64(ev, 32);
+    return _mm_blend_epi16(ev, od, 0xcc);
+#elif SIMDPP_USE_NEON
+    int64x2 lo = vmull_s32(vget_low_s32(a.native()), vget_low_s32(b.native()));
+    int64x2 hi = vmull_s32(vget_high_s32(a.native()), vget_high_s32(b.native()));
+    return unzip4_hi(int32x4(lo), int32x4(hi));
+#elif SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    int32<8> ab;
+    ab = mull(a, b);
+#if SIMDPP_BIG_ENDIAN
+    return unzip4_lo(ab.vec<0>(), ab.vec<1>());
+#else
+    return unzip4_hi(ab.vec<0>(), ab.vec<1>());
+#endif
+#else
+    // signed multiplication is not available, the unsigned result is fixed up:
+    // high(a * b) = high(ua * ub) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+    int32<4> r = i_mul_hi(uint32<4>(a), uint32<4>(b));
+    int32<4> sa = shift_r<31>(a);
+    int32<4> sb = shift_r<31>(b);
+    r = sub(r, bit_and(sa, b));
+    r = sub(r, bit_and(sb, a));
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_mul_hi(const int32<8>& a, const int32<8>& b)
+{
+    __m256i ev = _mm256_mul_epi32(a.native(), b.native());
+    __m256i od = _mm256_mul_epi32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_mul_hi(const int32<16>& a, const int32<16>& b)
+{
+    __m512i ev = _mm512_mul_epi32(a.native(), b.native());
+    __m512i od = _mm512_mul_epi32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_blend_epi32(0xaaaa, ev, od);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  Computes the high half of 64-bit multiplication using 32-bit
+    multiplications of the halves of the elements. The halves are multiplied
+    in place, thus the vectors don't need to be narrowed or widened.
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_u64(const V& a, const V& b)
+{
+    using w_u32 = typename same_width<V>::u32;
+
+    V bs = bit_or(shift_l<32>(b), shift_r<32>(b));
+    w_u32 a32 = w_u32(a);
+    w_u32 b32 = w_u32(b);
+    w_u32 bs32 = w_u32(bs);
+
+    // The low 32-bit halves hold al * bl and al * bh, the high halves hold
+    // ah * bh and ah * bl
+    V p_lo = V(mul_lo(a32, b32));
+    V p_hi = V(mul_hi(a32, b32));
+    V c_lo = V(mul_lo(a32, bs32));
+    V c_hi = V(mul_hi(a32, bs32));
+
+    // the sum of the middle terms can't overflow 64 bits
+    V lo_mask = make_uint(0xffffffff);
+    V mid = add(bit_and(p_hi, lo_mask), bit_and(c_lo, lo_mask));
+    mid = add(mid, shift_r<32>(c_lo));
+
+    V hh = bit_or(bit_andnot(p_hi, lo_mask), shift_r<32>(p_lo));
+    V r = add(hh, bit_and(c_hi, lo_mask));
+    r = add(r, shift_r<32>(c_hi));
+    return add(r, shift_r<32>(mid));
+}
+
+/*  Computes the high half of signed 64-bit multiplication from the unsigned
+    one:
+
+    high(a * b) = high(ua * ub) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+*/
+template<class V, class U> SIMDPP_INL
+V v_emul_mul_hi_i64(const V& a, const V& b, const U& r_unsigned)
+{
+    V r = V(r_unsigned);
+    V sa = shift_r<63>(a);
+    V sb = shift_r<63>(b);
+    r = sub(r, bit_and(sa, b));
+    r = sub(r, bit_and(sb, a));
+    return r;
+}
+
+static SIMDPP_INL
+uint64<2> i_mul_hi(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_mul_hi_u64(a.el(i), b.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    // Hacker's Delight 8-2, mulhu with 32-bit digits
+    __m128i lo_mask = _mm_set1_epi64x(0xffffffff);
+    __m128i ah = _mm_srli_epi64(a.native(), 32);
+    __m128i bh = _mm_srli_epi64(b.native(), 32);
+    __m128i ll = _mm_mul_epu32(a.native(), b.native());
+    __m128i lh = _mm_mul_epu32(a.native(), bh);
+    __m128i hl = _mm_mul_epu32(ah, b.native());
+    __m128i hh = _mm_mul_epu32(ah, bh);
+
+    __m128i t = _mm_add_epi64(hl, _mm_srli_epi64(ll, 32));
+    __m128i w = _mm_add_epi64(lh, _mm_and_si128(t, lo_mask));
+    hh = _mm_add_epi64(hh, _mm_srli_epi64(t, 32));
+    return _mm_add_epi64(hh, _mm_srli_epi64(w, 32));
+#elif SIMDPP_USE_NEON
+    uint32x2_t al = vmovn_u64(a.native());
+    uint32x2_t bl = vmovn_u64(b.native());
+    uint32x2_t ah = vshrn_n_u64(a.native(), 32);
+    uint32x2_t bh = vshrn_n_u64(b.native(), 32);
+    uint64x2_t ll = vmull_u32(al, bl);
+    uint64x2_t hl = vmull_u32(ah, bl);
+
+    uint64x2_t t = vsraq_n_u64(hl, ll, 32);
+    uint64x2_t w = vmlal_u32(vandq_u64(t, vdupq_n_u64(0xffffffff)), al, bh);
+    uint64x2_t r = vsraq_n_u64(vmull_u32(ah, bh), t, 32);
+    return vsraq_n_u64(r, w, 32);
+#else
+    return v_emul_mul_hi_u64(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_hi(const uint64<4>& a, const uint64<4>& b)
+{
+    __m256i lo_mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i ah = _mm256_srli_epi64(a.native(), 32);
+    __m256i bh = _mm256_srli_epi64(b.native(), 32);
+    __m256i ll = _mm256_mul_epu32(a.native(), b.native());
+    __m256i lh = _mm256_mul_epu32(a.native(), bh);
+    __m256i hl = _mm256_mul_epu32(ah, b.native());
+    __m256i hh = _mm256_mul_epu32(ah, bh);
+
+    __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+    __m256i w = _mm256_add_epi64(lh, _mm256_and_si256(t, lo_mask));
+    hh = _mm256_add_epi64(hh, _mm256_srli_epi64(t, 32));
+    return _mm256_add_epi64(hh, _mm256_srli_epi64(w, 32));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_hi(const uint64<8>& a, const uint64<8>& b)
+{
+    __m512i lo_mask = _mm512_set1_epi64(0xffffffff);
+    __m512i ah = _mm512_srli_epi64(a.native(), 32);
+    __m512i bh = _mm512_srli_epi64(b.native(), 32);
+    __m512i ll = _mm512_mul_epu32(a.native(), b.native());
+    __m512i lh = _mm512_mul_epu32(a.native(), bh);
+    __m512i hl = _mm512_mul_epu32(ah, b.native());
+    __m512i hh = _mm512_mul_epu32(ah, bh);
+
+    __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+    __m512i w = _mm512_add_epi64(lh, _mm512_and_si512(t, lo_mask));
+    hh = _mm512_add_epi64(hh, _mm512_srli_epi64(t, 32));
+    return _mm512_add_epi64(hh, _mm512_srli_epi64(w, 32));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int64<2> i_mul_hi(const int64<2>& a, const int64<2>& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    int64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = detail::null::el_mul_hi_i64(a.el(i), b.el(i));
+    }
+    return r;
+#else
+    return v_emul_mul_hi_i64(a, b, i_mul_hi(uint64<2>(a), uint64<2>(b)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int64<4> i_mul_hi(const int64<4>& a, const int64<4>& b)
+{
+    return v_emul_mul_hi_i64(a, b, i_mul_hi(uint64<4>(a), uint64<4>(b)));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_mul_hi(const int64<8>& a, const int64<8>& b)
+{
+    return v_emul_mul_hi_i64(a, b, i_mul_hi(uint64<8>(a), uint64<8>(b)));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_hi(const V& a, const V& b)
 {
@@ -13,11 +13,18 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_mull.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/detail/null/math.h>
+#include <simdpp/detail/width.h>
 #include <simdpp/detail/vector_array_macros.h>
 
 namespace simdpp {
@@ -140,6 +147,93 @@ uint32<16> i_mul_lo(const uint32<16>& a, const uint32<16>& b)
 
 // -----------------------------------------------------------------------------
 
+/*  Computes the low half of 64-bit multiplication using 32-bit multiplications
+    of the halves of the elements. The halves are multiplied in place, thus the
+    vectors don't need to be narrowed or widened.
+
+    lo(a * b) = al * bl + ((al * bh + ah * bl) << 32)
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_lo_u64(const V& a, const V& b)
+{
+    using w_u32 = typename same_width<V>::u32;
+
+    V bs = bit_or(shift_l<32>(b), shift_r<32>(b));
+    w_u32 a32 = w_u32(a);
+    w_u32 b32 = w_u32(b);
+    w_u32 bs32 = w_u32(bs);
+
+    V p_lo = V(mul_lo(a32, b32));
+    V p_hi = V(mul_hi(a32, b32));
+    V c_lo = V(mul_lo(a32, bs32));
+
+    V lo_mask = make_uint(0xffffffff);
+    V ll = bit_or(bit_and(p_lo, lo_mask), shift_l<32>(p_hi));
+    V cross = add(shift_l<32>(c_lo), bit_andnot(c_lo, lo_mask));
+    return add(ll, cross);
+}
+
+static SIMDPP_INL
+uint64<2> i_mul_lo(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::mul(a, b);
+#elif SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    __m128i ll = _mm_mul_epu32(a.native(), b.native());
+    __m128i lh = _mm_mul_epu32(a.native(), _mm_srli_epi64(b.native(), 32));
+    __m128i hl = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32), b.native());
+    __m128i cross = _mm_slli_epi64(_mm_add_epi64(lh, hl), 32);
+    return _mm_add_epi64(ll, cross);
+#elif SIMDPP_USE_NEON
+    uint32x2_t al = vmovn_u64(a.native());
+    uint32x2_t bl = vmovn_u64(b.native());
+    uint32x4_t bs = vrev64q_u32(vreinterpretq_u32_u64(b.native()));
+    uint32x4_t cross = vmulq_u32(bs, vreinterpretq_u32_u64(a.native()));
+    uint64x2_t r = vshlq_n_u64(vpaddlq_u32(cross), 32);
+    return vmlal_u32(r, al, bl);
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_mulv_d((v2i64) a.native(), (v2i64) b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    __m256i ll = _mm256_mul_epu32(a.native(), b.native());
+    __m256i lh = _mm256_mul_epu32(a.native(), _mm256_srli_epi64(b.native(), 32));
+    __m256i hl = _mm256_mul_epu32(_mm256_srli_epi64(a.native(), 32), b.native());
+    __m256i cross = _mm256_slli_epi64(_mm256_add_epi64(lh, hl), 32);
+    return _mm256_add_epi64(ll, cross);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    __m512i ll = _mm512_mul_epu32(a.native(), b.native());
+    __m512i lh = _mm512_mul_epu32(a.native(), _mm512_srli_epi64(b.native(), 32));
+    __m512i hl = _mm512_mul_epu32(_mm512_srli_epi64(a.native(), 32), b.native());
+    __m512i cross = _mm512_slli_epi64(_mm512_add_epi64(lh, hl), 32);
+    return _mm512_add_epi64(ll, cross);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_lo(const V& a, const V& b)
 {
@@ -79,12 +79,14 @@ uint32_t i_reduce_popcnt(const uint32<8>& a)
 static SIMDPP_INL
 uint32_t i_reduce_popcnt(const uint32<16>& a)
 {
-#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    uint64<8> r = _mm512_popcnt_epi64(a.native());
+    return reduce_add(r);
+#elif SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
     uint32<8> a0, a1;
     split(a, a0, a1);
     return i_reduce_popcnt(a0) + i_reduce_popcnt(a1);
 #else
-    // TODO: support AVX512VPOPCNTDQ
     uint64<8> r = popcnt((uint64<8>)a);
     return reduce_add(r);
 #endif
@@ -0,0 +1,608 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_ROTATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/not_implemented.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/null/math.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  All functions in this file expect 0 < count < num_bits for the compile-time
+    shift counts. The zero count is handled by the wrappers at the end of the
+    file. Vector shift counts are taken modulo the number of bits in the
+    element.
+*/
+
+// emulates funnel shift using two shifts
+template<unsigned count, class V> SIMDPP_INL
+V v_emul_shift_l2(const V& a, const V& b)
+{
+    V hi = shift_l<count>(a);
+    V lo = shift_r<V::num_bits - count>(b);
+    return bit_or(hi, lo);
+}
+
+// emulates variable rotate using variable shifts
+template<class V> SIMDPP_INL
+V v_emul_rotate_l_v(const V& a, const V& count)
+{
+    V mask = make_uint(V::num_bits - 1);
+    V zero = make_zero();
+    V count_l = bit_and(count, mask);
+    V count_r = sub(zero, count);
+    count_r = bit_and(count_r, mask);
+    V hi = shift_l(a, count_l);
+    V lo = shift_r(a, count_r);
+    return bit_or(hi, lo);
+}
+
+// -----------------------------------------------------------------------------
+// funnel shift by compile-time constant
+
+template<unsigned count> SIMDPP_INL
+uint8<16> i_shift_l2(const uint8<16>& a, const uint8<16>& b)
+{
+#if SIMDPP_USE_NEON
+    return vsriq_n_u8(vshlq_n_u8(a.native(), count), b.native(), 8 - count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint8<32> i_shift_l2(const uint8<32>& a, const uint8<32>& b)
+{
+    return v_emul_shift_l2<count>(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint8<64> i_shift_l2(const uint8<64>& a, const uint8<64>& b)
+{
+    return v_emul_shift_l2<count>(a, b);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint16<8> i_shift_l2(const uint16<8>& a, const uint16<8>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_shldi_epi16(a.native(), b.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u16(vshlq_n_u16(a.native(), count), b.native(), 16 - count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint16<16> i_shift_l2(const uint16<16>& a, const uint16<16>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_shldi_epi16(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint16<32> i_shift_l2(const uint16<32>& a, const uint16<32>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_shldi_epi16(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint32<4> i_shift_l2(const uint32<4>& a, const uint32<4>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_shldi_epi32(a.native(), b.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u32(vshlq_n_u32(a.native(), count), b.native(), 32 - count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint32<8> i_shift_l2(const uint32<8>& a, const uint32<8>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_shldi_epi32(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint32<16> i_shift_l2(const uint32<16>& a, const uint32<16>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_shldi_epi32(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint64<2> i_shift_l2(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_shldi_epi64(a.native(), b.native(), count);
+#elif SIMDPP_USE_NEON
+    return vsriq_n_u64(vshlq_n_u64(a.native(), count), b.native(), 64 - count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint64<4> i_shift_l2(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_shldi_epi64(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint64<8> i_shift_l2(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_shldi_epi64(a.native(), b.native(), count);
+#else
+    return v_emul_shift_l2<count>(a, b);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count, class V> SIMDPP_INL
+V i_shift_l2(const V& a, const V& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, V, i_shift_l2<count>, a, b);
+}
+
+// -----------------------------------------------------------------------------
+// rotate by compile-time constant
+
+template<unsigned count> SIMDPP_INL
+uint8<16> i_rotate_l(const uint8<16>& a)
+{
+#if SIMDPP_USE_XOP
+    return _mm_roti_epi8(a.native(), count);
+#elif SIMDPP_USE_ALTIVEC
+    uint8<16> shift = make_uint(count);
+    return vec_rl(a.native(), shift.native());
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint8<32> i_rotate_l(const uint8<32>& a)
+{
+    return i_shift_l2<count>(a, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint8<64> i_rotate_l(const uint8<64>& a)
+{
+    return i_shift_l2<count>(a, a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint16<8> i_rotate_l(const uint16<8>& a)
+{
+#if SIMDPP_USE_XOP
+    return _mm_roti_epi16(a.native(), count);
+#elif SIMDPP_USE_ALTIVEC
+    uint16<8> shift = make_uint(count);
+    return vec_rl(a.native(), shift.native());
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint16<16> i_rotate_l(const uint16<16>& a)
+{
+    return i_shift_l2<count>(a, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint16<32> i_rotate_l(const uint16<32>& a)
+{
+    return i_shift_l2<count>(a, a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint32<4> i_rotate_l(const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_rol_epi32(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi32(a.native(), count);
+#elif SIMDPP_USE_ALTIVEC
+    uint32<4> shift = make_uint(count);
+    return vec_rl(a.native(), shift.native());
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint32<8> i_rotate_l(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi32(a.native(), count);
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint32<16> i_rotate_l(const uint32<16>& a)
+{
+    return _mm512_rol_epi32(a.native(), count);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count> SIMDPP_INL
+uint64<2> i_rotate_l(const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_rol_epi64(a.native(), count);
+#elif SIMDPP_USE_XOP
+    return _mm_roti_epi64(a.native(), count);
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<unsigned count> SIMDPP_INL
+uint64<4> i_rotate_l(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rol_epi64(a.native(), count);
+#else
+    return i_shift_l2<count>(a, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned count> SIMDPP_INL
+uint64<8> i_rotate_l(const uint64<8>& a)
+{
+    return _mm512_rol_epi64(a.native(), count);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<unsigned count, class V> SIMDPP_INL
+V i_rotate_l(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, i_rotate_l<count>, a);
+}
+
+// -----------------------------------------------------------------------------
+// rotate by vector
+
+static SIMDPP_INL
+uint8<16> i_rotate_l_v(const uint8<16>& a, const uint8<16>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::rotate_l_v(a, count);
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi8(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    return v_emul_rotate_l_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_rotate_l_v(const uint8<32>& a, const uint8<32>& count)
+{
+    return v_emul_rotate_l_v(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_rotate_l_v(const uint8<64>& a, const uint8<64>& count)
+{
+    return v_emul_rotate_l_v(a, count);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_rotate_l_v(const uint16<8>& a, const uint16<8>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::rotate_l_v(a, count);
+#elif SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_shldv_epi16(a.native(), a.native(), count.native());
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi16(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_MSA
+    return v_emul_rotate_l_v(a, count);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_rotate_l_v(const uint16<16>& a, const uint16<16>& count)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_shldv_epi16(a.native(), a.native(), count.native());
+#else
+    return v_emul_rotate_l_v(a, count);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_rotate_l_v(const uint16<32>& a, const uint16<32>& count)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_shldv_epi16(a.native(), a.native(), count.native());
+#else
+    return v_emul_rotate_l_v(a, count);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_rotate_l_v(const uint32<4>& a, const uint32<4>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::rotate_l_v(a, count);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rolv_epi32(a.native(), count.native());
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi32(a.native(), count.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_rl(a.native(), count.native());
+#else
+    return v_emul_rotate_l_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_rotate_l_v(const uint32<8>& a, const uint32<8>& count)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rolv_epi32(a.native(), count.native());
+#else
+    return v_emul_rotate_l_v(a, count);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_rotate_l_v(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_rolv_epi32(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+// 64-bit shifts by vector are not provided, thus the rotates are implemented
+// directly on all architectures
+static SIMDPP_INL
+uint64<2> i_rotate_l_v(const uint64<2>& a, const uint64<2>& count)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::rotate_l_v(a, count);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_rolv_epi64(a.native(), count.native());
+#elif SIMDPP_USE_XOP
+    return _mm_rot_epi64(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    uint64<2> mask = make_uint(63);
+    uint64<2> zero = make_zero();
+    uint64<2> count_l = bit_and(count, mask);
+    uint64<2> count_r = sub(zero, count);
+    count_r = bit_and(count_r, mask);
+#if SIMDPP_USE_AVX2
+    __m128i hi = _mm_sllv_epi64(a.native(), count_l.native());
+    __m128i lo = _mm_srlv_epi64(a.native(), count_r.native());
+    return _mm_or_si128(hi, lo);
+#else
+    // SSE2 shifts use the same count for all elements, thus each element is
+    // shifted separately and the results are combined afterwards
+    __m128i count_l1 = _mm_unpackhi_epi64(count_l.native(), count_l.native());
+    __m128i count_r1 = _mm_unpackhi_epi64(count_r.native(), count_r.native());
+    __m128i r0 = _mm_or_si128(_mm_sll_epi64(a.native(), count_l.native()),
+                              _mm_srl_epi64(a.native(), count_r.native()));
+    __m128i r1 = _mm_or_si128(_mm_sll_epi64(a.native(), count_l1),
+                              _mm_srl_epi64(a.native(), count_r1));
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r1),
+                                        _mm_castsi128_pd(r0)));
+#endif
+#elif SIMDPP_USE_NEON
+    uint64<2> mask = make_uint(63);
+    int64x2_t count_l = vreinterpretq_s64_u64(vandq_u64(count.native(), mask.native()));
+    int64x2_t count_r = vsubq_s64(count_l, vdupq_n_s64(64));
+    return vorrq_u64(vshlq_u64(a.native(), count_l),
+                     vshlq_u64(a.native(), count_r));
+#elif SIMDPP_USE_MSA
+    v2i64 count_r = __msa_subv_d(__msa_ldi_d(0), (v2i64) count.native());
+    v2i64 hi = __msa_sll_d((v2i64) a.native(), (v2i64) count.native());
+    v2i64 lo = __msa_srl_d((v2i64) a.native(), count_r);
+    return (v2u64) __msa_or_v((v16u8) hi, (v16u8) lo);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_rotate_l_v(const uint64<4>& a, const uint64<4>& count)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_rolv_epi64(a.native(), count.native());
+#else
+    uint64<4> mask = make_uint(63);
+    uint64<4> zero = make_zero();
+    uint64<4> count_l = bit_and(count, mask);
+    uint64<4> count_r = sub(zero, count);
+    count_r = bit_and(count_r, mask);
+    __m256i hi = _mm256_sllv_epi64(a.native(), count_l.native());
+    __m256i lo = _mm256_srlv_epi64(a.native(), count_r.native());
+    return _mm256_or_si256(hi, lo);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_rotate_l_v(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_rolv_epi64(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_rotate_l_v(const V& a, const V& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, V, i_rotate_l_v, a, count);
+}
+
+template<class V> SIMDPP_INL
+V i_rotate_r_v(const V& a, const V& count)
+{
+    V zero = make_zero();
+    V neg_count = sub(zero, count);
+    return i_rotate_l_v(a, neg_count);
+}
+
+// -----------------------------------------------------------------------------
+
+template<bool no_shift>
+struct i_rotate_l_wrapper {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& arg) { return i_rotate_l<count>(arg); }
+};
+template<>
+struct i_rotate_l_wrapper<true> {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& arg) { return arg; }
+};
+
+template<bool no_shift>
+struct i_shift_l2_wrapper {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& a, const V& b) { return i_shift_l2<count>(a, b); }
+};
+template<>
+struct i_shift_l2_wrapper<true> {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& a, const V&) { return a; }
+};
+
+template<bool no_shift>
+struct i_shift_r2_wrapper {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& a, const V& b)
+    {
+        return i_shift_l2<V::num_bits - count>(b, a);
+    }
+};
+template<>
+struct i_shift_r2_wrapper<true> {
+    template<unsigned count, class V>
+    static SIMDPP_INL V run(const V& a, const V&) { return a; }
+};
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,306 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_EXPAND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_EXPAND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/detail/compress_lut.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned E> SIMDPP_INL
+unsigned i_load_expand_bits_scalar(uint8<16>& r, const char* p, unsigned bits)
+{
+    SIMDPP_ALIGN(16) char data[16];
+    std::memset(data, 0, 16);
+    unsigned count = 0;
+    for (unsigned i = 0; i < 16 / E; ++i) {
+        if (bits & (1u << i)) {
+            std::memcpy(data + i * E, p + count * E, E);
+            count++;
+        }
+    }
+    r = load(data);
+    return count;
+}
+
+// Loads consecutive elements into the lanes of a 128-bit vector that are
+// selected by @a bits and zeroes the rest. E is the element size and must be
+// 2, 4 or 8. Returns the number of loaded elements.
+template<unsigned E> SIMDPP_INL
+unsigned i_load_expand_bits(uint8<16>& r, const char* p, unsigned bits)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_load_expand_bits_scalar<E>(r, p, bits);
+#else
+    const auto& lut = expand_lut<16 / E, E>::get();
+    uint8<16> idx = load(lut.idx[bits]);
+    uint8<16> a = load_u(p);
+    r = permute_zbytes16(a, idx);
+    return compress_count(bits);
+#endif
+}
+
+// Same as above, for 8-bit elements
+static SIMDPP_INL
+unsigned i_load_expand_bits8(uint8<16>& r, const char* p, unsigned bits)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_load_expand_bits_scalar<1>(r, p, bits);
+#else
+    const auto& lut = expand_lut<8, 1>::get();
+    unsigned count_lo = compress_count(bits & 0xff);
+    uint64_t idx_lo, idx_hi;
+    std::memcpy(&idx_lo, lut.idx[bits & 0xff], 8);
+    std::memcpy(&idx_hi, lut.idx[bits >> 8], 8);
+    // The zeroing indices stay within 0x80-0x88, thus remain zeroing
+    idx_hi += 0x0101010101010101 * count_lo;
+    uint64<2> idx = make_uint(idx_lo, idx_hi);
+    uint8<16> a = load_u(p);
+    r = permute_zbytes16(a, uint8<16>(idx));
+    return count_lo + compress_count(bits >> 8);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+// Expands 32-bit elements across the whole 256-bit vector. The lanes that
+// are not selected contain arbitrary values.
+static SIMDPP_INL
+unsigned i_load_expand_bits_u32x8(uint32<8>& r, const char* p, unsigned bits)
+{
+    const auto& lut = expand_lut<8, 1>::get();
+    __m256i idx = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.idx[bits])));
+    uint32<8> a = load_u(p);
+    r = _mm256_permutevar8x32_epi32(a.native(), idx);
+    return compress_count(bits);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_load_expand(uint8<16>& r, const char* p, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    r = _mm_maskz_expandloadu_epi8(mask.native(), p);
+    return compress_count(mask.native());
+#else
+    return i_load_expand_bits8(r, p, extract_bits_any(mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_load_expand(uint8<32>& r, const char* p, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_expandloadu_epi8(mask.native(), p);
+    return compress_count(mask.native());
+#else
+    uint32_t bits = extract_bits_any(mask);
+    uint8<16> r0, r1;
+    unsigned count = i_load_expand_bits8(r0, p, bits & 0xffff);
+    count += i_load_expand_bits8(r1, p + count, bits >> 16);
+    r = combine(r0, r1);
+    return count;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+unsigned i_load_expand(uint8<64>& r, const char* p, const mask_int8<64>& mask)
+{
+    uint64_t bits = mask.native();
+#if SIMDPP_USE_AVX512VBMI2
+    r = _mm512_maskz_expandloadu_epi8(bits, p);
+    return compress_count(uint32_t(bits)) + compress_count(uint32_t(bits >> 32));
+#else
+    uint8<16> r0, r1, r2, r3;
+    unsigned count = i_load_expand_bits8(r0, p, bits & 0xffff);
+    count += i_load_expand_bits8(r1, p + count, (bits >> 16) & 0xffff);
+    count += i_load_expand_bits8(r2, p + count, (bits >> 32) & 0xffff);
+    count += i_load_expand_bits8(r3, p + count, bits >> 48);
+    r = combine(combine(r0, r1), combine(r2, r3));
+    return count;
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_load_expand(uint16<8>& r, const char* p, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    r = _mm_maskz_expandloadu_epi16(mask.native(), p);
+    return compress_count(mask.native());
+#else
+    uint8<16> r8;
+    unsigned count = i_load_expand_bits<2>(r8, p, extract_bits_any(mask));
+    r = r8;
+    return count;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_load_expand(uint16<16>& r, const char* p, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_expandloadu_epi16(mask.native(), p);
+    return compress_count(mask.native());
+#else
+    unsigned bits = extract_bits_any(mask);
+    uint8<16> r0, r1;
+    unsigned count = i_load_expand_bits<2>(r0, p, bits & 0xff);
+    count += i_load_expand_bits<2>(r1, p + count * 2, bits >> 8);
+    r = combine(uint16<8>(r0), uint16<8>(r1));
+    return count;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+unsigned i_load_expand(uint16<32>& r, const char* p, const mask_int16<32>& mask)
+{
+    uint32_t bits = mask.native();
+#if SIMDPP_USE_AVX512VBMI2
+    r = _mm512_maskz_expandloadu_epi16(bits, p);
+    return compress_count(bits);
+#else
+    uint8<16> r0, r1, r2, r3;
+    unsigned count = i_load_expand_bits<2>(r0, p, bits & 0xff);
+    count += i_load_expand_bits<2>(r1, p + count * 2, (bits >> 8) & 0xff);
+    count += i_load_expand_bits<2>(r2, p + count * 2, (bits >> 16) & 0xff);
+    count += i_load_expand_bits<2>(r3, p + count * 2, bits >> 24);
+    r = combine(combine(uint16<8>(r0), uint16<8>(r1)),
+                combine(uint16<8>(r2), uint16<8>(r3)));
+    return count;
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_load_expand(uint32<4>& r, const char* p, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm_maskz_expandloadu_epi32(mask.native(), p);
+    return compress_count(mask.native() & 0xf);
+#else
+    uint8<16> r8;
+    unsigned count = i_load_expand_bits<4>(r8, p, extract_bits_any(mask));
+    r = r8;
+    return count;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_load_expand(uint32<8>& r, const char* p, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_expandloadu_epi32(mask.native(), p);
+    return compress_count(mask.native());
+#else
+    unsigned count = i_load_expand_bits_u32x8(r, p, extract_bits_any(mask));
+    r = bit_and(r, mask);
+    return count;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_load_expand(uint32<16>& r, const char* p, const mask_int32<16>& mask)
+{
+    r = _mm512_maskz_expandloadu_epi32(mask.native(), p);
+    return compress_count(mask.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_load_expand(uint64<2>& r, const char* p, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm_maskz_expandloadu_epi64(mask.native(), p);
+    return compress_count(mask.native() & 0x3);
+#else
+    uint8<16> r8;
+    unsigned count = i_load_expand_bits<8>(r8, p, extract_bits_any(mask));
+    r = r8;
+    return count;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_load_expand(uint64<4>& r, const char* p, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_expandloadu_epi64(mask.native(), p);
+    return compress_count(mask.native() & 0xf);
+#else
+    uint32<8> r32;
+    unsigned bits = compress_bits64_to_32(extract_bits_any(mask));
+    unsigned count = i_load_expand_bits_u32x8(r32, p, bits) / 2;
+    r = bit_and(uint64<4>(r32), mask);
+    return count;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_load_expand(uint64<8>& r, const char* p, const mask_int64<8>& mask)
+{
+    r = _mm512_maskz_expandloadu_epi64(mask.native(), p);
+    return compress_count(mask.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+unsigned i_load_expand(V& r, const char* p, const M& mask)
+{
+    const unsigned elsize = sizeof(typename V::element_type);
+    unsigned count = 0;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        count += i_load_expand(r.vec(i), p + count * elsize, mask.vec(i));
+    }
+    return count;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,320 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_PERMUTE_VAR_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_PERMUTE_VAR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/insn/permute_bytes16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<class V> SIMDPP_INL
+V i_permute_var_scalar(const V& a, const V& idx)
+{
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+    SIMDPP_ALIGN(64) E idx_data[V::length];
+    SIMDPP_ALIGN(64) E r_data[V::length];
+    store(data, a);
+    store(idx_data, idx);
+    for (unsigned i = 0; i < V::length; ++i) {
+        r_data[i] = data[idx_data[i] % V::length];
+    }
+    return load(r_data);
+}
+
+// Converts indices of elements to the indices of the bytes of these elements
+template<unsigned N> SIMDPP_INL
+uint8<N*2> i_permute_var_byte_idx(const uint16<N>& idx)
+{
+    uint16<N> b = shift_l<1>(idx);
+    b = bit_or(b, shift_l<8>(b));
+    uint16<N> offsets = make_uint(0x0100);
+    return uint8<N*2>(add(b, offsets));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N*4> i_permute_var_byte_idx(const uint32<N>& idx)
+{
+    uint32<N> b = shift_l<2>(idx);
+    b = bit_or(b, shift_l<8>(b));
+    b = bit_or(b, shift_l<16>(b));
+    uint32<N> offsets = make_uint(0x03020100);
+    return uint8<N*4>(add(b, offsets));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N*8> i_permute_var_byte_idx(const uint64<N>& idx)
+{
+    uint64<N> b = shift_l<3>(idx);
+    b = bit_or(b, shift_l<8>(b));
+    b = bit_or(b, shift_l<16>(b));
+    b = bit_or(b, shift_l<32>(b));
+    uint64<N> offsets = make_uint(0x0706050403020100);
+    return uint8<N*8>(add(b, offsets));
+}
+
+/*  Selects bytes across the whole vector. The indices must be less than the
+    number of elements in the vector.
+*/
+static SIMDPP_INL
+uint8<16> i_permute_var_bytes(const uint8<16>& a, const uint8<16>& idx)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    return i_permute_var_scalar(a, idx);
+#else
+    return i_permute_bytes16(a, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_permute_var_bytes(const uint8<32>& a, const uint8<32>& idx)
+{
+    // Each 128-bit lane is broadcast to the whole vector and looked up
+    // separately. Bit 4 of the index then selects the lane.
+    __m256i lo = _mm256_permute2x128_si256(a.native(), a.native(), 0x00);
+    __m256i hi = _mm256_permute2x128_si256(a.native(), a.native(), 0x11);
+    lo = _mm256_shuffle_epi8(lo, idx.native());
+    hi = _mm256_shuffle_epi8(hi, idx.native());
+    __m256i sel = _mm256_slli_epi16(idx.native(), 3);
+    return _mm256_blendv_epi8(lo, hi, sel);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_permute_var_bytes(const uint8<64>& a, const uint8<64>& idx)
+{
+    __m512i r0 = _mm512_shuffle_i32x4(a.native(), a.native(), 0x00);
+    __m512i r1 = _mm512_shuffle_i32x4(a.native(), a.native(), 0x55);
+    __m512i r2 = _mm512_shuffle_i32x4(a.native(), a.native(), 0xaa);
+    __m512i r3 = _mm512_shuffle_i32x4(a.native(), a.native(), 0xff);
+    r0 = _mm512_shuffle_epi8(r0, idx.native());
+    r1 = _mm512_shuffle_epi8(r1, idx.native());
+    r2 = _mm512_shuffle_epi8(r2, idx.native());
+    r3 = _mm512_shuffle_epi8(r3, idx.native());
+    __mmask64 sel4 = _mm512_test_epi8_mask(idx.native(), _mm512_set1_epi8(0x10));
+    __mmask64 sel5 = _mm512_test_epi8_mask(idx.native(), _mm512_set1_epi8(0x20));
+    r0 = _mm512_mask_blend_epi8(sel4, r0, r1);
+    r2 = _mm512_mask_blend_epi8(sel4, r2, r3);
+    return _mm512_mask_blend_epi8(sel5, r0, r2);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint8<16> i_permute_var(const uint8<16>& a, const uint8<16>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI && SIMDPP_USE_AVX512VL
+    return _mm_permutexvar_epi8(idx.native(), a.native());
+#else
+    uint8<16> mask = make_uint(0x0f);
+    return i_permute_var_bytes(a, bit_and(idx, mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_permute_var(const uint8<32>& a, const uint8<32>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI && SIMDPP_USE_AVX512VL
+    return _mm256_permutexvar_epi8(idx.native(), a.native());
+#else
+    uint8<32> mask = make_uint(0x1f);
+    return i_permute_var_bytes(a, bit_and(idx, mask));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_permute_var(const uint8<64>& a, const uint8<64>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI
+    return _mm512_permutexvar_epi8(idx.native(), a.native());
+#else
+    uint8<64> mask = make_uint(0x3f);
+    return i_permute_var_bytes(a, bit_and(idx, mask));
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_permute_var(const uint16<8>& a, const uint16<8>& idx)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    return _mm_permutexvar_epi16(idx.native(), a.native());
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_permute_var_scalar(a, idx);
+#else
+    uint16<8> mask = make_uint(0x7);
+    return uint16<8>(i_permute_var_bytes(uint8<16>(a),
+                                         i_permute_var_byte_idx(bit_and(idx, mask))));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_permute_var(const uint16<16>& a, const uint16<16>& idx)
+{
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+    return _mm256_permutexvar_epi16(idx.native(), a.native());
+#else
+    uint16<16> mask = make_uint(0xf);
+    return uint16<16>(i_permute_var_bytes(uint8<32>(a),
+                                          i_permute_var_byte_idx(bit_and(idx, mask))));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_permute_var(const uint16<32>& a, const uint16<32>& idx)
+{
+    return _mm512_permutexvar_epi16(idx.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_permute_var(const uint32<4>& a, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX
+    return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(a.native()),
+                                              idx.native()));
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_permute_var_scalar(a, idx);
+#else
+    uint32<4> mask = make_uint(0x3);
+    return uint32<4>(i_permute_var_bytes(uint8<16>(a),
+                                         i_permute_var_byte_idx(bit_and(idx, mask))));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_permute_var(const uint32<8>& a, const uint32<8>& idx)
+{
+    return _mm256_permutevar8x32_epi32(a.native(), idx.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_permute_var(const uint32<16>& a, const uint32<16>& idx)
+{
+    return _mm512_permutexvar_epi32(idx.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_permute_var(const uint64<2>& a, const uint64<2>& idx)
+{
+#if SIMDPP_USE_AVX
+    // vpermilpd takes the index from bit 1
+    return _mm_castpd_si128(_mm_permutevar_pd(_mm_castsi128_pd(a.native()),
+                                              _mm_slli_epi64(idx.native(), 1)));
+#elif SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_permute_var_scalar(a, idx);
+#else
+    uint64<2> mask = make_uint(0x1);
+    return uint64<2>(i_permute_var_bytes(uint8<16>(a),
+                                         i_permute_var_byte_idx(bit_and(idx, mask))));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_permute_var(const uint64<4>& a, const uint64<4>& idx)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_permutexvar_epi64(idx.native(), a.native());
+#else
+    // Each 64-bit index i is converted to a pair of 32-bit indices 2i, 2i+1
+    uint64<4> mask = make_uint(0x3);
+    uint64<4> offsets = make_uint(uint64_t(1) << 32);
+    uint64<4> i32 = shift_l<1>(bit_and(idx, mask));
+    i32 = add(bit_or(i32, shift_l<32>(i32)), offsets);
+    return _mm256_permutevar8x32_epi32(a.native(), i32.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_permute_var(const uint64<8>& a, const uint64<8>& idx)
+{
+    return _mm512_permutexvar_epi64(idx.native(), a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  Selects elements from the concatenation of @a count native vectors at
+    @a src. The indices are taken modulo the total number of elements. @a count
+    must be a power of two. Each native vector is looked up separately and the
+    results are merged according to the upper bits of the indices.
+*/
+template<class V> SIMDPP_INL
+V i_permute_var_multi(const typename V::base_vector_type* src, unsigned count,
+                      const V& idx)
+{
+    using B = typename V::base_vector_type;
+    using E = typename V::element_type;
+    const unsigned L = B::length;
+
+    B sel_mask = make_uint(E((count * L - 1) & ~(L - 1)));
+    V r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        B ri = i_permute_var(src[0], idx.vec(i));
+        B sel = bit_and(idx.vec(i), sel_mask);
+        for (unsigned k = 1; k < count; ++k) {
+            B t = i_permute_var(src[k], idx.vec(i));
+            B k_sel = make_uint(E(k * L));
+            ri = blend(t, ri, cmp_eq(sel, k_sel));
+        }
+        r.vec(i) = ri;
+    }
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V i_permute_var(const V& a, const V& idx)
+{
+    return i_permute_var_multi(&a.vec(0), a.vec_length, idx);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,247 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <cstddef>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Stores the elements of @a a to @a base indexed by @a idx. The elements are
+    stored in order, thus if several indices are equal, the last element is
+    kept. If @a mask is not null, only the elements whose mask element is
+    nonzero are stored.
+*/
+template<class V> SIMDPP_INL
+void i_scatter_scalar(char* base, const int32_t* idx, const V& a,
+                      const V* mask = nullptr)
+{
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+    SIMDPP_ALIGN(64) E mask_data[V::length];
+    store(data, a);
+    if (mask) {
+        store(mask_data, *mask);
+    }
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (!mask || mask_data[i] != 0) {
+            std::memcpy(base + std::ptrdiff_t(idx[i]) * sizeof(E), &data[i], sizeof(E));
+        }
+    }
+}
+
+template<class V> SIMDPP_INL
+void i_scatter_scalar(char* base, const uint32<V::length>& idx, const V& a)
+{
+    SIMDPP_ALIGN(64) int32_t idx_data[V::length];
+    store(idx_data, idx);
+    i_scatter_scalar(base, idx_data, a);
+}
+
+template<class V, class M> SIMDPP_INL
+void i_scatter_masked_scalar(char* base, const uint32<V::length>& idx, const V& a,
+                             const M& mask)
+{
+    SIMDPP_ALIGN(64) int32_t idx_data[V::length];
+    store(idx_data, idx);
+    V vmask = mask.unmask();
+    i_scatter_scalar(base, idx_data, a, &vmask);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_scalar(base, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_epi32(base, idx.native(), a.native(), 4);
+#else
+    i_scatter_scalar(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(base, idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const uint32<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter(base, idx.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<4>& idx, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_epi64(base, idx.native(), a.native(), 8);
+#else
+    i_scatter_scalar(base, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* base, const uint32<8>& idx, const uint64<8>& a)
+{
+    _mm512_i32scatter_epi64(base, idx.native(), a.native(), 8);
+}
+#endif
+
+// See the comment for i_gather for vectors of 64-bit elements
+template<unsigned N> SIMDPP_INL
+void i_scatter(char* base, const uint32<N>& idx, const uint64<N>& a)
+{
+#if SIMDPP_USE_AVX2
+    using I = typename uint32<N>::base_vector_type;
+    for (unsigned i = 0; i < idx.vec_length; ++i) {
+        uint32<I::length / 2> idx0, idx1;
+        split(idx.vec(i), idx0, idx1);
+        i_scatter(base, idx0, a.vec(i*2));
+        i_scatter(base, idx1, a.vec(i*2+1));
+    }
+#else
+    const unsigned veclen = uint64<N>::base_vector_type::length;
+    SIMDPP_ALIGN(64) int32_t idx_data[N];
+    store(idx_data, idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_scalar(base, idx_data + i*veclen, a.vec(i));
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const uint32<4>& a,
+                      const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_scalar(base, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const uint32<8>& a,
+                      const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+#else
+    i_scatter_masked_scalar(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<16>& idx, const uint32<16>& a,
+                      const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(base, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const uint32<N>& a,
+                      const mask_int32<N>& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked(base, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<4>& idx, const uint64<4>& a,
+                      const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_epi64(base, mask.native(), idx.native(), a.native(), 8);
+#else
+    i_scatter_masked_scalar(base, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<8>& idx, const uint64<8>& a,
+                      const mask_int64<8>& mask)
+{
+    _mm512_mask_i32scatter_epi64(base, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(char* base, const uint32<N>& idx, const uint64<N>& a,
+                      const mask_int64<N>& mask)
+{
+#if SIMDPP_USE_AVX2
+    using I = typename uint32<N>::base_vector_type;
+    for (unsigned i = 0; i < idx.vec_length; ++i) {
+        uint32<I::length / 2> idx0, idx1;
+        split(idx.vec(i), idx0, idx1);
+        i_scatter_masked(base, idx0, a.vec(i*2), mask.vec(i*2));
+        i_scatter_masked(base, idx1, a.vec(i*2+1), mask.vec(i*2+1));
+    }
+#else
+    const unsigned veclen = uint64<N>::base_vector_type::length;
+    SIMDPP_ALIGN(64) int32_t idx_data[N];
+    store(idx_data, idx);
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        typename uint64<N>::base_vector_type vmask = mask.vec(i).unmask();
+        i_scatter_scalar(base, idx_data + i*veclen, a.vec(i), &vmask);
+    }
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,147 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SHUFFLE_VAR_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SHUFFLE_VAR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/permute_var.h>
+#include <simdpp/detail/insn/shuffle_bytes16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+#if !(SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+static SIMDPP_INL
+uint8<16> i_shuffle_var(const uint8<16>& a, const uint8<16>& b, const uint8<16>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI && SIMDPP_USE_AVX512VL
+    return _mm_permutex2var_epi8(a.native(), idx.native(), b.native());
+#else
+    uint8<16> mask = make_uint(0x1f);
+    return i_shuffle_bytes16(a, b, bit_and(idx, mask));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512VBMI && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint8<32> i_shuffle_var(const uint8<32>& a, const uint8<32>& b, const uint8<32>& idx)
+{
+    return _mm256_permutex2var_epi8(a.native(), idx.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512VBMI
+static SIMDPP_INL
+uint8<64> i_shuffle_var(const uint8<64>& a, const uint8<64>& b, const uint8<64>& idx)
+{
+    return _mm512_permutex2var_epi8(a.native(), idx.native(), b.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_shuffle_var(const uint16<8>& a, const uint16<8>& b, const uint16<8>& idx)
+{
+    return _mm_permutex2var_epi16(a.native(), idx.native(), b.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_shuffle_var(const uint16<16>& a, const uint16<16>& b, const uint16<16>& idx)
+{
+    return _mm256_permutex2var_epi16(a.native(), idx.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_shuffle_var(const uint16<32>& a, const uint16<32>& b, const uint16<32>& idx)
+{
+    return _mm512_permutex2var_epi16(a.native(), idx.native(), b.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint32<4> i_shuffle_var(const uint32<4>& a, const uint32<4>& b, const uint32<4>& idx)
+{
+    return _mm_permutex2var_epi32(a.native(), idx.native(), b.native());
+}
+
+static SIMDPP_INL
+uint32<8> i_shuffle_var(const uint32<8>& a, const uint32<8>& b, const uint32<8>& idx)
+{
+    return _mm256_permutex2var_epi32(a.native(), idx.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_shuffle_var(const uint32<16>& a, const uint32<16>& b, const uint32<16>& idx)
+{
+    return _mm512_permutex2var_epi32(a.native(), idx.native(), b.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint64<2> i_shuffle_var(const uint64<2>& a, const uint64<2>& b, const uint64<2>& idx)
+{
+    return _mm_permutex2var_epi64(a.native(), idx.native(), b.native());
+}
+
+static SIMDPP_INL
+uint64<4> i_shuffle_var(const uint64<4>& a, const uint64<4>& b, const uint64<4>& idx)
+{
+    return _mm256_permutex2var_epi64(a.native(), idx.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_shuffle_var(const uint64<8>& a, const uint64<8>& b, const uint64<8>& idx)
+{
+    return _mm512_permutex2var_epi64(a.native(), idx.native(), b.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+// The native vectors of both sources form a single table of 2N elements
+template<class V> SIMDPP_INL
+V i_shuffle_var(const V& a, const V& b, const V& idx)
+{
+    using B = typename V::base_vector_type;
+    B src[V::vec_length * 2];
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        src[i] = a.vec(i);
+        src[V::vec_length + i] = b.vec(i);
+    }
+    return i_permute_var_multi(src, V::vec_length * 2, idx);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
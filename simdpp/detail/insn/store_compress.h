@@ -0,0 +1,291 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/compress_lut.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned E> SIMDPP_INL
+unsigned i_store_compress_bits_scalar(char* p, const uint8<16>& a, unsigned bits)
+{
+    SIMDPP_ALIGN(16) char data[16];
+    store(data, a);
+    unsigned count = 0;
+    for (unsigned i = 0; i < 16 / E; ++i) {
+        if (bits & (1u << i)) {
+            std::memcpy(p + count * E, data + i * E, E);
+            count++;
+        }
+    }
+    return count;
+}
+
+// Stores the elements of a 128-bit vector that are selected by @a bits. E is
+// the element size and must be 2, 4 or 8.
+template<unsigned E> SIMDPP_INL
+unsigned i_store_compress_bits(char* p, const uint8<16>& a, unsigned bits)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_store_compress_bits_scalar<E>(p, a, bits);
+#else
+    const auto& lut = compress_lut<16 / E, E>::get();
+    uint8<16> idx = load(lut.idx[bits]);
+    store_u(p, permute_bytes16(a, idx));
+    return compress_count(bits);
+#endif
+}
+
+// Same as above, for 8-bit elements. The table would be too large for 16
+// lanes, thus each half of the vector is compressed separately.
+static SIMDPP_INL
+unsigned i_store_compress_bits8(char* p, const uint8<16>& a, unsigned bits)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    return i_store_compress_bits_scalar<1>(p, a, bits);
+#else
+    const auto& lut = compress_lut<8, 1>::get();
+    uint64_t idx_lo, idx_hi;
+    std::memcpy(&idx_lo, lut.idx[bits & 0xff], 8);
+    std::memcpy(&idx_hi, lut.idx[bits >> 8], 8);
+    idx_hi += 0x0808080808080808;
+    uint64<2> idx = make_uint(idx_lo, idx_hi);
+
+    SIMDPP_ALIGN(16) char data[16];
+    store(data, permute_bytes16(a, uint8<16>(idx)));
+    unsigned count_lo = compress_count(bits & 0xff);
+    std::memcpy(p, data, 8);
+    std::memcpy(p + count_lo, data + 8, 8);
+    return count_lo + compress_count(bits >> 8);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+// Compresses 32-bit elements across the whole 256-bit vector
+static SIMDPP_INL
+unsigned i_store_compress_bits_u32x8(char* p, const uint32<8>& a, unsigned bits)
+{
+    const auto& lut = compress_lut<8, 1>::get();
+    __m256i idx = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.idx[bits])));
+    store_u(p, uint32<8>(_mm256_permutevar8x32_epi32(a.native(), idx)));
+    return compress_count(bits);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint8<16>& a, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi8(p, mask.native(), a.native());
+    return compress_count(mask.native());
+#else
+    return i_store_compress_bits8(p, a, extract_bits_any(mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint8<32>& a, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi8(p, mask.native(), a.native());
+    return compress_count(mask.native());
+#else
+    uint32_t bits = extract_bits_any(mask);
+    uint8<16> a0, a1;
+    split(a, a0, a1);
+    unsigned count = i_store_compress_bits8(p, a0, bits & 0xffff);
+    return count + i_store_compress_bits8(p + count, a1, bits >> 16);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint8<64>& a, const mask_int8<64>& mask)
+{
+    uint64_t bits = mask.native();
+#if SIMDPP_USE_AVX512VBMI2
+    _mm512_mask_compressstoreu_epi8(p, bits, a.native());
+    return compress_count(uint32_t(bits)) + compress_count(uint32_t(bits >> 32));
+#else
+    uint8<32> a01, a23;
+    uint8<16> a0, a1, a2, a3;
+    split(a, a01, a23);
+    split(a01, a0, a1);
+    split(a23, a2, a3);
+    unsigned count = i_store_compress_bits8(p, a0, bits & 0xffff);
+    count += i_store_compress_bits8(p + count, a1, (bits >> 16) & 0xffff);
+    count += i_store_compress_bits8(p + count, a2, (bits >> 32) & 0xffff);
+    return count + i_store_compress_bits8(p + count, a3, bits >> 48);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint16<8>& a, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi16(p, mask.native(), a.native());
+    return compress_count(mask.native());
+#else
+    return i_store_compress_bits<2>(p, uint8<16>(a), extract_bits_any(mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint16<16>& a, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi16(p, mask.native(), a.native());
+    return compress_count(mask.native());
+#else
+    unsigned bits = extract_bits_any(mask);
+    uint16<8> a0, a1;
+    split(a, a0, a1);
+    unsigned count = i_store_compress_bits<2>(p, uint8<16>(a0), bits & 0xff);
+    return count + i_store_compress_bits<2>(p + count * 2, uint8<16>(a1), bits >> 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint16<32>& a, const mask_int16<32>& mask)
+{
+    uint32_t bits = mask.native();
+#if SIMDPP_USE_AVX512VBMI2
+    _mm512_mask_compressstoreu_epi16(p, bits, a.native());
+    return compress_count(bits);
+#else
+    uint16<16> a01, a23;
+    uint16<8> a0, a1, a2, a3;
+    split(a, a01, a23);
+    split(a01, a0, a1);
+    split(a23, a2, a3);
+    unsigned count = i_store_compress_bits<2>(p, uint8<16>(a0), bits & 0xff);
+    count += i_store_compress_bits<2>(p + count * 2, uint8<16>(a1), (bits >> 8) & 0xff);
+    count += i_store_compress_bits<2>(p + count * 2, uint8<16>(a2), (bits >> 16) & 0xff);
+    return count + i_store_compress_bits<2>(p + count * 2, uint8<16>(a3), bits >> 24);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint32<4>& a, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return compress_count(mask.native() & 0xf);
+#else
+    return i_store_compress_bits<4>(p, uint8<16>(a), extract_bits_any(mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint32<8>& a, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return compress_count(mask.native());
+#else
+    return i_store_compress_bits_u32x8(p, a, extract_bits_any(mask));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_compressstoreu_epi32(p, mask.native(), a.native());
+    return compress_count(mask.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint64<2>& a, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return compress_count(mask.native() & 0x3);
+#else
+    return i_store_compress_bits<8>(p, uint8<16>(a), extract_bits_any(mask));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint64<4>& a, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return compress_count(mask.native() & 0xf);
+#else
+    unsigned bits = compress_bits64_to_32(extract_bits_any(mask));
+    return i_store_compress_bits_u32x8(p, uint32<8>(a), bits) / 2;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_store_compress(char* p, const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_compressstoreu_epi64(p, mask.native(), a.native());
+    return compress_count(mask.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+unsigned i_store_compress(char* p, const V& a, const M& mask)
+{
+    const unsigned elsize = sizeof(typename V::element_type);
+    unsigned count = 0;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        count += i_store_compress(p + count * elsize, a.vec(i), mask.vec(i));
+    }
+    return count;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -219,6 +219,36 @@ uint64_t el_popcnt64(uint64_t v)
     return v;
 }
 
+static SIMDPP_INL
+uint32_t el_bit_width32(uint32_t v)
+{
+    uint32_t r = 0;
+    for (; v != 0; v >>= 1) {
+        r++;
+    }
+    return r;
+}
+
+static SIMDPP_INL
+uint64_t el_bit_width64(uint64_t v)
+{
+    uint64_t r = 0;
+    for (; v != 0; v >>= 1) {
+        r++;
+    }
+    return r;
+}
+
+template<class T> SIMDPP_INL
+T el_lzcnt(T v)
+{
+    T r = sizeof(T) * 8;
+    for (; v != 0; v >>= 1) {
+        r--;
+    }
+    return r;
+}
+
 } // namespace null
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
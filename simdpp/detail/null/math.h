@@ -146,6 +146,25 @@ V mul(const V& a, const V& b)
     return r;
 }
 
+static SIMDPP_INL
+uint64_t el_mul_hi_u64(uint64_t a, uint64_t b)
+{
+    uint64_t al = a & 0xffffffff, ah = a >> 32;
+    uint64_t bl = b & 0xffffffff, bh = b >> 32;
+    uint64_t t = ah * bl + ((al * bl) >> 32);
+    uint64_t w = al * bh + (t & 0xffffffff);
+    return ah * bh + (t >> 32) + (w >> 32);
+}
+
+static SIMDPP_INL
+int64_t el_mul_hi_i64(int64_t a, int64_t b)
+{
+    uint64_t r = el_mul_hi_u64(uint64_t(a), uint64_t(b));
+    r -= a < 0 ? uint64_t(b) : 0;
+    r -= b < 0 ? uint64_t(a) : 0;
+    return int64_t(r);
+}
+
 template<class V> SIMDPP_INL
 V fmadd(const V& a, const V& b, const V& c)
 {
@@ -224,6 +243,20 @@ V shift_l_v(const V& a, const S& shift)
     return r;
 }
 
+template<class V, class S> SIMDPP_INL
+V rotate_l_v(const V& a, const S& count)
+{
+    using E = typename V::element_type;
+    const unsigned bits = sizeof(E) * 8;
+    V r;
+    for (unsigned i = 0; i < V::length; i++) {
+        unsigned c = unsigned(count.el(i)) & (bits - 1);
+        E x = a.el(i);
+        r.el(i) = c == 0 ? x : E((x << c) | (x >> (bits - c)));
+    }
+    return r;
+}
+
 template<class V> SIMDPP_INL
 V min(const V& a, const V& b)
 {
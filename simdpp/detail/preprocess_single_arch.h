@@ -91,6 +91,24 @@
 #ifdef SIMDPP_ARCH_PP_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#undef SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512BITALG
+#undef SIMDPP_ARCH_PP_USE_AVX512BITALG
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_FMA3
 #undef SIMDPP_ARCH_PP_USE_FMA3
 #endif
@@ -155,6 +173,24 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_FMA3
 #undef SIMDPP_ARCH_PP_NS_USE_FMA3
 #endif
@@ -185,7 +221,7 @@
 
 #ifdef SIMDPP_ARCH_PP_LIST
 
-    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,...)    \
+    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,x14,x15,x16,x17,x18,x19,...)    \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x0) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x1) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x2) | \
@@ -199,9 +235,15 @@
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x10) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x11) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x12) | \
-        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x13)
-
-    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0,0) )
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x13) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x14) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x15) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x16) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x17) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x18) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x19)
+
+    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0) )
     #define SIMDPP_ARCH_PP_MASK SIMDPP_ARCH_PP_CREATE_MASK(SIMDPP_ARCH_PP_LIST)
 
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SSE2) == SIMDPP_INSN_MASK_SSE2
@@ -246,6 +288,24 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VL) == SIMDPP_INSN_MASK_AVX512VL
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VBMI) == SIMDPP_INSN_MASK_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VBMI2) == SIMDPP_INSN_MASK_AVX512VBMI2
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI2 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VNNI) == SIMDPP_INSN_MASK_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512BITALG) == SIMDPP_INSN_MASK_AVX512BITALG
+        #define SIMDPP_ARCH_PP_USE_AVX512BITALG 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VPOPCNTDQ) == SIMDPP_INSN_MASK_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512CD) == SIMDPP_INSN_MASK_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_NEON) == SIMDPP_INSN_MASK_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
     #endif
@@ -325,6 +385,30 @@
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
         #undef SIMDPP_ARCH_X86_AVX512VL
     #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+        #undef SIMDPP_ARCH_X86_AVX512VBMI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VBMI2
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI2 1
+        #undef SIMDPP_ARCH_X86_AVX512VBMI2
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+        #undef SIMDPP_ARCH_X86_AVX512VNNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512BITALG
+        #define SIMDPP_ARCH_PP_USE_AVX512BITALG 1
+        #undef SIMDPP_ARCH_X86_AVX512BITALG
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+        #undef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+        #undef SIMDPP_ARCH_X86_AVX512CD
+    #endif
     #ifdef SIMDPP_ARCH_ARM_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
         #undef SIMDPP_ARCH_ARM_NEON
@@ -353,6 +437,42 @@
 
 // Define support of instruction sets that are implicitly available when another
 // instruction set is available
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     #ifndef SIMDPP_ARCH_PP_USE_AVX512F
         #define SIMDPP_ARCH_PP_USE_AVX512F 1
@@ -486,7 +606,8 @@
 #if SIMDPP_ARCH_PP_USE_AVX2 && !SIMDPP_ARCH_PP_USE_AVX512F
 #define SIMDPP_ARCH_PP_NS_USE_AVX2 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL
+#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL && \
+    !SIMDPP_ARCH_PP_USE_AVX512VNNI && !SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ && !SIMDPP_ARCH_PP_USE_AVX512CD
 #define SIMDPP_ARCH_PP_NS_USE_AVX512F 1
 #endif
 #if SIMDPP_ARCH_PP_USE_AVX512BW
@@ -498,6 +619,24 @@
 #if SIMDPP_ARCH_PP_USE_AVX512VL
 #define SIMDPP_ARCH_PP_NS_USE_AVX512VL 1
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VBMI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VNNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+#define SIMDPP_ARCH_PP_NS_USE_AVX512BITALG 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_ARCH_PP_NS_USE_AVX512CD 1
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_ARCH_PP_NS_USE_FMA3 1
 #endif
@@ -54,6 +54,18 @@ enum class Arch : std::uint32_t {
     X86_AVX512DQ = 1 << 13,
     /// Indicates x86 AVX-512VL suppotr
     X86_AVX512VL = 1 << 14,
+    /// Indicates x86 AVX-512VBMI support
+    X86_AVX512VBMI = 1 << 15,
+    /// Indicates x86 AVX-512VBMI2 support
+    X86_AVX512VBMI2 = 1 << 16,
+    /// Indicates x86 AVX-512VNNI support
+    X86_AVX512VNNI = 1 << 17,
+    /// Indicates x86 AVX-512BITALG support
+    X86_AVX512BITALG = 1 << 18,
+    /// Indicates x86 AVX-512VPOPCNTDQ support
+    X86_AVX512VPOPCNTDQ = 1 << 19,
+    /// Indicates x86 AVX-512CD support
+    X86_AVX512CD = 1 << 20,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
@@ -156,6 +156,18 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_AVX512DQ;
         if (ebx & (1u << 31) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX512VL;
+        if (ecx & (1u << 1) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI;
+        if (ecx & (1u << 6) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VBMI2;
+        if (ecx & (1u << 11) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (ecx & (1u << 12) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512BITALG;
+        if (ecx & (1u << 14) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (ebx & (1u << 28) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_AVX512CD;
     }
 
     return arch_info;
@@ -55,6 +55,12 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
@@ -70,6 +76,12 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
     features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("avx512vbmi", a_avx512vbmi);
+    features.emplace_back("avx512vbmi2", a_avx512vbmi2);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("avx512bitalg", a_avx512bitalg);
+    features.emplace_back("avx512vpopcntdq", a_avx512vpopcntdq);
+    features.emplace_back("avx512cd", a_avx512cd);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
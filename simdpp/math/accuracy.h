@@ -0,0 +1,62 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_ACCURACY_H
+#define LIBSIMDPP_SIMDPP_MATH_ACCURACY_H
+
+namespace simdpp {
+namespace math {
+
+/*  Tags that select the accuracy tier of a math function. They are passed as
+    an optional last argument, e.g. log(x, math::ulp4()). The tags are not
+    specific to any instruction set, thus they are not defined within the
+    architecture namespace.
+
+    All functions in simdpp/math accept all tags, except log2_approx() and
+    rsqrt_newton() whose accuracy is fixed by their name or by the number of
+    iterations, and the functions in simdpp/math/frexp.h which are exact. Each
+    tag derives from the next more accurate one, thus when a function does not
+    have a separate implementation for a tier, overload resolution selects the
+    implementation of the closest more accurate tier.
+    The documentation of each function lists the tiers that it implements
+    separately.
+
+    The maximum error is 1 ULP with ulp1 and 4 ULP with ulp4 over the
+    entire range, unless the documentation of a function states a smaller
+    bound. The bounds of all functions and tiers are listed in the table of
+    test/math_accuracy/accuracy_table.cc, which fails if any of them is
+    exceeded.
+*/
+
+/// Selects the implementation whose maximum error is 1 ULP
+struct ulp1 {};
+
+/// Selects a faster implementation whose maximum error is 4 ULP
+struct ulp4 : ulp1 {};
+
+/** Selects the fastest implementation, whose error is documented for each
+    function separately. It is usually expressed as absolute or relative
+    error instead of ULP, and the handling of special values may be
+    simplified.
+*/
+struct fast : ulp4 {};
+
+/*  The tier that is used when the tag is omitted. It can be changed for the
+    whole program by defining SIMDPP_MATH_DEFAULT_ACCURACY to one of the tag
+    names, e.g. -DSIMDPP_MATH_DEFAULT_ACCURACY=ulp4. The definition must be
+    the same in all translation units.
+*/
+#ifndef SIMDPP_MATH_DEFAULT_ACCURACY
+#define SIMDPP_MATH_DEFAULT_ACCURACY ulp1
+#endif
+
+using default_accuracy = SIMDPP_MATH_DEFAULT_ACCURACY;
+
+} // namespace math
+} // namespace simdpp
+
+#endif
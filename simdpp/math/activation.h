@@ -0,0 +1,982 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_ACTIVATION_H
+#define LIBSIMDPP_SIMDPP_MATH_ACTIVATION_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/exp.h>
+#include <simdpp/math/detail/math_util.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  erfc(y) is computed as exp(-y^2) * erfcx(y) for y >= 0.84375. erfcx(y) is
+    approximated by polynomials of the same degree on three intervals, thus
+    the coefficients can be selected per element and a single polynomial
+    evaluated. The first two intervals use the shifted argument y - shift,
+    the last one approximates y * erfcx(y) in terms of t - shift, t = 1/y.
+    Beyond y_max erfc(y) underflows to zero.
+
+    The float64 tables are accompanied by the remainders of the two leading
+    coefficients, which the double-word evaluation adds separately.
+
+    The constants of gelu_tanh() are 2*sqrt(2/pi) and 2*sqrt(2/pi)*0.044715
+    split into the nearest representable values and the remainders.
+
+    exp_split() clamps its argument to exp_min_arg, which is low enough for
+    the result to underflow to zero even after scaling by the largest x_max.
+*/
+template<class V> struct erf_consts;
+
+template<unsigned N> struct erf_consts<float32<N>> {
+    static const unsigned erf_small_degree = 5;
+    static const unsigned erfcx_degree = 8;
+    static float y_small() { return 0.84375f; }
+    static float y_mid() { return 2.0f; }
+    static float y_large() { return 3.5f; }
+    static float y_max() { return 11.0f; }
+    static float shift1() { return 1.421875f; }
+    static float shift2() { return 2.75f; }
+    static float shift3() { return 0.19f; }
+    static const double* erf_small()
+    {
+        static const double c[] = {
+            1.12837916079329852848e+00, -3.76125764052363833517e-01,
+            1.12827756031392647936e-01, -2.68051041992990206232e-02,
+            5.05562273062980057866e-03, -6.34292130867587131457e-04
+        };
+        return c;
+    }
+    static const double* erfcx1()
+    {
+        static const double c[] = {
+            3.34849462069612832925e-01, -1.76150965378882053008e-01,
+            8.43847661279008686083e-02, -3.74460243652869531657e-02,
+            1.55718805610603329483e-02, -6.10265090172929671932e-03,
+            2.28581101785573526108e-03, -8.92229756902939144965e-04,
+            3.01146201491854802173e-04
+        };
+        return c;
+    }
+    static const double* erfcx2()
+    {
+        static const double c[] = {
+            1.93662096235365321007e-01, -6.32376291217739316756e-02,
+            1.97585934229134475005e-02, -5.93453827062068221819e-03,
+            1.71960862768332300173e-03, -4.80917682744474470682e-04,
+            1.30932580143863248432e-04, -3.76855316785692816181e-05,
+            9.61553031305933902305e-06
+        };
+        return c;
+    }
+    static const double* erfcx3()
+    {
+        static const double c[] = {
+            5.54513068747185344879e-01, -9.69371894263404146918e-02,
+            -2.07235588396635643289e-01, 2.14651194758882845206e-01,
+            7.58884675230108832101e-02, -4.17211526457656355938e-01,
+            3.51934112985883280059e-01, 4.71976440013667620306e-01,
+            -1.50189440468455435372e+00
+        };
+        return c;
+    }
+    static float k1_hi() { return 1.59576917f; }
+    static float k1_lo() { return -4.53406805e-08f; }
+    static float k2_hi() { return 0.0713548139f; }
+    static float k2_lo() { return 2.39883247e-09f; }
+    static float gelu_tanh_x_max() { return 20.0f; }
+    static float exp_min_arg() { return -120.0f; }
+};
+
+template<unsigned N> struct erf_consts<float64<N>> {
+    static const unsigned erf_small_degree = 10;
+    static const unsigned erfcx_degree = 18;
+    static double y_small() { return 0.84375; }
+    static double y_mid() { return 2.0; }
+    static double y_large() { return 3.5; }
+    static double y_max() { return 28.0; }
+    static double shift1() { return 1.421875; }
+    static double shift2() { return 2.75; }
+    static double shift3() { return 0.16; }
+    static const double* erf_small()
+    {
+        static const double c[] = {
+            1.12837916709551256265e+00, -3.76126389031833757365e-01,
+            1.12837916709341916438e-01, -2.68661706405808090220e-02,
+            5.22397757457751245993e-03, -8.54832369750715526223e-04,
+            1.20551969720248134748e-04, -1.49220632605144566064e-05,
+            1.64009371219149192862e-06, -1.57099042670695334700e-07,
+            1.07138247601772072409e-08
+        };
+        return c;
+    }
+    static const double* erfcx1()
+    {
+        static const double c[] = {
+            3.34849462405517717123e-01, -1.76151008379821560901e-01,
+            8.43847473654589369518e-02, -3.74442971463728527248e-02,
+            1.55718186802297989951e-02, -6.12124698418061840427e-03,
+            2.28939020820810796089e-03, -8.18862937389525980848e-04,
+            2.81267367100984460281e-04, -9.30968704086301449907e-05,
+            2.97790529112754864685e-05, -9.22811285797673163766e-06,
+            2.77629100684684679542e-06, -8.12529058143264513708e-07,
+            2.31627963532733046820e-07, -6.40601783376262637806e-08,
+            1.74129628973422669412e-08, -5.16891094913783169785e-09,
+            1.33921889163593440292e-09
+        };
+        return c;
+    }
+    static const double* erfcx2()
+    {
+        static const double c[] = {
+            1.93662096279068690619e-01, -6.32376375606348434255e-02,
+            1.97585929873228642595e-02, -5.93433789699793993316e-03,
+            1.71958188528920693366e-03, -4.82195084982195854972e-04,
+            1.31181800530671174420e-04, -3.46986095616128405921e-05,
+            8.94015604454768279591e-06, -2.24737355699504186485e-06,
+            5.51975847175413343201e-07, -1.32624879194313245084e-07,
+            3.12091952072967994958e-08, -7.20150116281276831896e-09,
+            1.63022352251069948550e-09, -3.59907376666636628520e-10,
+            7.86742302739097030991e-11, -1.91518424098182011772e-11,
+            4.03609643778513547946e-12
+        };
+        return c;
+    }
+    static const double* erfcx3()
+    {
+        static const double c[] = {
+            5.57228948670464907522e-01, -8.39334305129887242591e-02,
+            -2.26027742192534270016e-01, 2.01615521313149970162e-01,
+            1.42685238632852623430e-01, -4.69541778069739179635e-01,
+            2.16912796174323130316e-01, 8.50846323383041780453e-01,
+            -1.76268618570428658998e+00, 1.08176740652991917879e-01,
+            5.66762674542891442542e+00, -1.04516233510310989629e+01,
+            -2.15517037925223808870e+00, 4.77552702001863309533e+01,
+            -9.14703212386792330335e+01, -3.05334029113094764796e+01,
+            5.05500604423131505882e+02, -6.59140781878488837719e+02,
+            -7.15386728195071896153e+02
+        };
+        return c;
+    }
+    static const double* erfcx1_lo()
+    {
+        static const double c[] = {
+            2.64546665778510719756e-18, 1.31282686977213002766e-18
+        };
+        return c;
+    }
+    static const double* erfcx2_lo()
+    {
+        static const double c[] = {
+            -1.20158465327391743853e-17, 1.50178938870213043252e-18
+        };
+        return c;
+    }
+    static const double* erfcx3_lo()
+    {
+        static const double c[] = {
+            2.91704432889510773408e-17, 1.10128638705497847582e-18
+        };
+        return c;
+    }
+    static double rsqrt2_hi() { return 0.70710678118654757; }
+    static double rsqrt2_lo() { return -4.8336466567264567e-17; }
+    static double gelu_x_max() { return 39.5; }
+    static double k1_hi() { return 1.5957691216057308; }
+    static double k1_lo() { return -9.9693088091109202e-17; }
+    static double k2_hi() { return 0.071354816272600249; }
+    static double k2_lo() { return -6.175149918155315e-19; }
+    static double gelu_tanh_x_max() { return 40.0; }
+    static double exp_min_arg() { return -760.0; }
+};
+
+/*  Computes tanh(x) = x + x^3 * P(x^2) for |x| <= 0.625.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> tanh_small(const float32<N>& x)
+{
+    float32<N> z = mul(x, x);
+    float32<N> p = horner(z, -3.33333289484444422691e-01, 1.33327700836397549349e-01,
+                          -5.38509534778267853155e-02, 2.09973575400530504842e-02,
+                          -6.09694154866526502401e-03);
+    return mul_add(mul(x, z), p, x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> tanh_small(const float64<N>& x)
+{
+    float64<N> z = mul(x, x);
+    float64<N> p = horner(z, -3.33333333333333225756e-01, 1.33333333333266630759e-01,
+                          -5.39682539614000568877e-02, 2.18694882607054840900e-02,
+                          -8.86322983335233625943e-03, 3.59205900059133339230e-03,
+                          -1.45530943166217767097e-03, 5.87437767797531533845e-04,
+                          -2.30777208783633185257e-04, 7.96008151414183001807e-05,
+                          -1.72455173677091052104e-05);
+    return mul_add(mul(x, z), p, x);
+}
+
+/*  Computes erf(y) = y * P(y^2) for |y| < 0.84375. @a z must be y^2.
+*/
+template<class V> SIMDPP_INL
+V erf_small(const V& y, const V& z)
+{
+    const double* c = erf_consts<V>::erf_small();
+    unsigned n = erf_consts<V>::erf_small_degree;
+    V p = make_float(c[n]);
+    for (unsigned i = n; i-- > 0;) {
+        p = mul_add(p, z, V(make_float(c[i])));
+    }
+    return mul(y, p);
+}
+
+template<class V, class M> SIMDPP_INL
+V erfcx_coef(double c1, double c2, double c3, const M& is_2, const M& is_3)
+{
+    V v1 = make_float(c1);
+    V v2 = make_float(c2);
+    V v3 = make_float(c3);
+    return blend(v3, blend(v2, v1, is_2), is_3);
+}
+
+/*  Splits exp(a) for a <= 0 into 2^n * p. Multiplying p by a factor before
+    the final scaling results in a single rounding even if the result is
+    subnormal.
+*/
+template<class V> SIMDPP_INL
+void exp_split(const V& a, V& n, V& p)
+{
+    V min_arg = make_float(erf_consts<V>::exp_min_arg());
+    V one = make_float(1.0);
+    V r;
+    exp_reduce(V(max(a, min_arg)), n, r);
+    p = add(expm1_reduced(r), one);
+}
+
+/*  Same as exp_split(), except that the argument is a + a_lo and the result
+    is computed in double-word precision: exp(a + a_lo) = 2^n * (hi + lo).
+*/
+template<unsigned N> SIMDPP_INL
+void exp_split_hi_lo(const float64<N>& a, const float64<N>& a_lo,
+                     float64<N>& n, float64<N>& hi, float64<N>& lo)
+{
+    using V = float64<N>;
+    V min_arg = make_float(erf_consts<V>::exp_min_arg());
+    V one = make_float(1.0);
+    V r, r_lo, q, q_lo, err;
+    exp_reduce_hi_lo(V(max(a, min_arg)), a_lo, n, r, r_lo);
+    expm1_reduced_hi_lo(r, r_lo, q, q_lo);
+    two_sum(one, q, hi, err);
+    lo = add(err, q_lo);
+}
+
+/*  Computes erf(y) for y < y_small and s * erfc(y) for y >= y_small, where
+    y = yh + yl, 0 <= yh <= y_max. The results for the other interval are
+    unspecified. The low part is only needed when y itself is the result of a
+    rounded computation: it is accounted for where the rounding error of yh
+    would otherwise be amplified, i.e. in exp(-y^2) and in erf(y) for small y.
+*/
+template<class V> SIMDPP_INL
+void erf_erfc_kernel(const V& yh, const V& yl, const V& s, V& erf_res, V& erfc_res)
+{
+    using C = erf_consts<V>;
+    V one = make_float(1.0);
+    V y_mid = make_float(C::y_mid());
+    V y_large = make_float(C::y_large());
+    V shift1 = make_float(C::shift1());
+    V shift2 = make_float(C::shift2());
+    V shift3 = make_float(C::shift3());
+
+    // erf(yh + yl) = erf(yh) + yl * 2/sqrt(pi) * exp(-yh^2) approximately
+    V two_over_sqrt_pi = make_float(1.12837916709551257390);
+    V z = mul(yh, yh);
+    V d = mul(horner(z, 1.0, -1.0, 0.5, -1.0 / 6.0), two_over_sqrt_pi);
+    erf_res = mul_add(yl, d, erf_small(yh, z));
+
+    auto is_2 = cmp_ge(yh, y_mid);
+    auto is_3 = cmp_ge(yh, y_large);
+    V t = div(one, yh);
+    V u = blend(sub(t, shift3), sub(yh, blend(shift2, shift1, is_2)), is_3);
+
+    const double* c1 = C::erfcx1();
+    const double* c2 = C::erfcx2();
+    const double* c3 = C::erfcx3();
+    unsigned n = C::erfcx_degree;
+    V p = erfcx_coef<V>(c1[n], c2[n], c3[n], is_2, is_3);
+    for (unsigned i = n; i-- > 0;) {
+        p = mul_add(p, u, erfcx_coef<V>(c1[i], c2[i], c3[i], is_2, is_3));
+    }
+    p = blend(mul(p, t), p, is_3);
+
+    // exp(-(h + l)) = exp(-h) * (1 - l) where h + l = y^2
+    V h, l, e, k;
+    two_prod(yh, yh, h, l);
+    l = mul_add(add(yh, yh), yl, l);
+    exp_split(V(neg(h)), k, e);
+    p = mul(mul_add(p, V(neg(l)), p), s);
+    erfc_res = scale_pow2(mul(e, p), k);
+}
+
+/*  Computes erf(yh + yl) = hi + lo in double-word precision for
+    0 <= yh < y_small. P is evaluated using the compensated Horner scheme and
+    the rounding error of y^2 is accounted for using the first two terms of
+    the derivative of P.
+*/
+template<unsigned N> SIMDPP_INL
+void erf_small_hi_lo(const float64<N>& yh, const float64<N>& yl,
+                     float64<N>& hi, float64<N>& lo)
+{
+    using V = float64<N>;
+    using C = erf_consts<V>;
+    V two_over_sqrt_pi = make_float(1.12837916709551257390);
+    const double* c = C::erf_small();
+    unsigned n = C::erf_small_degree;
+
+    V z, z_err, h_err;
+    two_prod(yh, yh, z, z_err);
+    V p = make_float(c[n]);
+    V p_lo = make_zero();
+    for (unsigned i = n; i-- > 0;) {
+        horner_step_hi_lo(p, p_lo, z, V(make_float(c[i])));
+    }
+    p_lo = mul_add(z_err, horner(z, c[1], 2 * c[2]), p_lo);
+
+    two_prod(yh, p, hi, h_err);
+    lo = mul_add(yh, p_lo, h_err);
+
+    // as in erf_erfc_kernel()
+    V d = mul(horner(z, 1.0, -1.0, 0.5, -1.0 / 6.0), two_over_sqrt_pi);
+    lo = mul_add(yl, d, lo);
+}
+
+/*  Computes erfc(yh + yl) = 2^n * (hi + lo) in double-word precision for
+    y_small <= yh <= y_max. The polynomials of erf_erfc_kernel() are
+    evaluated using the compensated Horner scheme at yh, with 1/yh computed
+    in double-word precision for the last interval, and then corrected for
+    yl using erfcx'(y) = 2y * erfcx(y) - 2/sqrt(pi).
+*/
+template<unsigned N> SIMDPP_INL
+void erfc_hi_lo(const float64<N>& yh, const float64<N>& yl,
+                float64<N>& n, float64<N>& hi, float64<N>& lo)
+{
+    using V = float64<N>;
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V y_mid = make_float(C::y_mid());
+    V y_large = make_float(C::y_large());
+    V shift1 = make_float(C::shift1());
+    V shift2 = make_float(C::shift2());
+    V shift3 = make_float(C::shift3());
+    V two_over_sqrt_pi = make_float(1.12837916709551257390);
+
+    auto is_2 = cmp_ge(yh, y_mid);
+    auto is_3 = cmp_ge(yh, y_large);
+
+    V t, t_lo, p, p_err, u, u_lo;
+    t = div(one, yh);
+    two_prod(t, yh, p, p_err);
+    t_lo = mul(sub(sub(one, p), p_err), t);
+    two_sum(t, V(neg(shift3)), u, u_lo);
+    u_lo = blend(add(u_lo, t_lo), zero, is_3);
+    u = blend(u, sub(yh, blend(shift2, shift1, is_2)), is_3);
+
+    const double* c1 = C::erfcx1();
+    const double* c2 = C::erfcx2();
+    const double* c3 = C::erfcx3();
+    unsigned deg = C::erfcx_degree;
+    V x = erfcx_coef<V>(c1[deg], c2[deg], c3[deg], is_2, is_3);
+    V x_lo = zero;
+    for (unsigned i = deg; i-- > 0;) {
+        horner_step_hi_lo(x, x_lo, u, erfcx_coef<V>(c1[i], c2[i], c3[i], is_2, is_3));
+    }
+    const double* l1 = C::erfcx1_lo();
+    const double* l2 = C::erfcx2_lo();
+    const double* l3 = C::erfcx3_lo();
+    x_lo = add(x_lo, mul_add(erfcx_coef<V>(l1[1], l2[1], l3[1], is_2, is_3), u,
+                             erfcx_coef<V>(l1[0], l2[0], l3[0], is_2, is_3)));
+    // u_lo is nonzero only in the last interval
+    x_lo = mul_add(u_lo, horner(u, c3[1], 2 * c3[2]), x_lo);
+
+    two_prod(x, t, p, p_err);
+    p_err = mul_add(x, t_lo, mul_add(x_lo, t, p_err));
+    x = blend(p, x, is_3);
+    x_lo = blend(p_err, x_lo, is_3);
+    x_lo = mul_add(yl, sub(mul(add(yh, yh), x), two_over_sqrt_pi), x_lo);
+
+    // exp(-(yh + yl)^2)
+    V h, l, e, e_lo, h_err;
+    two_prod(yh, yh, h, l);
+    l = mul_add(add(yh, yh), yl, l);
+    exp_split_hi_lo(V(neg(h)), V(neg(l)), n, e, e_lo);
+    two_prod(e, x, hi, h_err);
+    lo = mul_add(e, x_lo, mul_add(e_lo, x, h_err));
+}
+
+template<class V> SIMDPP_INL
+V v_tanh(const V& x, simdpp::math::ulp1)
+{
+    V one = make_float(1.0);
+    V two = make_float(2.0);
+    V small = make_float(0.625);
+    V sign_mask = make_float(-0.0);
+
+    // tanh(a) = 1 - 2 / (exp(2a) + 1) = 1 - 2 / (expm1(2a) + 2)
+    V a = abs(x);
+    V e = v_expm1(V(add(a, a)));
+    V r = sub(one, div(two, add(e, two)));
+    r = blend(tanh_small(a), r, cmp_lt(a, small));
+    return bit_or(r, bit_and(x, sign_mask));
+}
+
+template<class V> SIMDPP_INL
+V v_tanh(const V& x, simdpp::math::fast)
+{
+    V one = make_float(1.0);
+    V neg_two = make_float(-2.0);
+    V sign_mask = make_float(-0.0);
+
+    V e = v_exp_fast(V(mul(abs(x), neg_two)));
+    V r = div(sub(one, e), add(one, e));
+    r = bit_or(r, bit_and(x, sign_mask));
+    return blend(x, r, isnan(x));
+}
+
+/*  sigmoid(x) = 1 / (1 + exp(-x)) = exp(x) / (1 + exp(x)). The latter form
+    is used for negative arguments so that small results are not lost.
+*/
+template<class V> SIMDPP_INL
+V sigmoid_kernel(const V& x)
+{
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V e = v_exp(V(neg(abs(x))));
+    V d = add(one, e);
+    return blend(div(e, d), div(one, d), cmp_lt(x, zero));
+}
+
+/*  The single precision kernel has an error of up to 2 ULP, thus the float32
+    result is computed in double precision for the ulp1 tier.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_sigmoid(const float32<N>& x, simdpp::math::ulp1)
+{
+    return to_float32(sigmoid_kernel(to_float64(x)));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_sigmoid(const float32<N>& x, simdpp::math::ulp4)
+{
+    return sigmoid_kernel(x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_sigmoid(const float64<N>& x, simdpp::math::ulp4)
+{
+    return sigmoid_kernel(x);
+}
+
+/*  Computes m * sigmoid(vh + vl) in double-word precision. The quotient is
+    scaled by the exponent of e = exp(-|v|) = 2^n * (eh + el) last, so that
+    it's rounded only once more even if the result is subnormal.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> mul_sigmoid_hi_lo(const float64<N>& m, const float64<N>& vh,
+                             const float64<N>& vl)
+{
+    using V = float64<N>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+
+    auto is_neg = cmp_lt(vh, zero);
+    V n, e, e_lo, d, d_err, p, p_err;
+    exp_split_hi_lo(V(neg(abs(vh))), blend(vl, V(neg(vl)), is_neg), n, e, e_lo);
+    two_sum(one, V(scale_pow2(e, n)), d, d_err);
+    V d_lo = add(d_err, scale_pow2(e_lo, n));
+
+    two_prod(m, e, p, p_err);
+    p_err = mul_add(m, e_lo, p_err);
+    V num = blend(p, m, is_neg);
+    V num_lo = blend(p_err, zero, is_neg);
+    V k = blend(n, zero, is_neg);
+    return scale_pow2(div_hi_lo(num, num_lo, d, d_lo), k);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_sigmoid(const float64<N>& x, simdpp::math::ulp1)
+{
+    float64<N> zero = make_zero();
+    float64<N> one = make_float(1.0);
+    float64<N> r = mul_sigmoid_hi_lo(one, x, zero);
+    return blend(x, r, isnan(x));
+}
+
+template<class V> SIMDPP_INL
+V v_sigmoid(const V& x, simdpp::math::fast)
+{
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V e = v_exp_fast(V(neg(abs(x))));
+    V d = add(one, e);
+    V r = blend(div(e, d), div(one, d), cmp_lt(x, zero));
+    return blend(x, r, isnan(x));
+}
+
+template<class V> SIMDPP_INL
+V erf_kernel(const V& x)
+{
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V y_small = make_float(C::y_small());
+    V y_max = make_float(C::y_max());
+    V sign_mask = make_float(-0.0);
+
+    V y = min(abs(x), y_max);
+    V e, c;
+    erf_erfc_kernel(y, zero, one, e, c);
+    V r = blend(e, sub(one, c), cmp_lt(y, y_small));
+    r = bit_or(r, bit_and(x, sign_mask));
+    return blend(x, r, isnan(x));
+}
+
+// As in sigmoid(), float32 is computed in double precision for ulp1
+template<unsigned N> SIMDPP_INL
+float32<N> v_erf(const float32<N>& x, simdpp::math::ulp1)
+{
+    return to_float32(erf_kernel(to_float64(x)));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_erf(const float32<N>& x, simdpp::math::ulp4)
+{
+    return erf_kernel(x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_erf(const float64<N>& x, simdpp::math::ulp4)
+{
+    return erf_kernel(x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_erf(const float64<N>& x, simdpp::math::ulp1)
+{
+    using V = float64<N>;
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V y_small = make_float(C::y_small());
+    V y_max = make_float(C::y_max());
+    V sign_mask = make_float(-0.0);
+
+    V y = min(abs(x), y_max);
+    V e, e_lo, n, c, c_lo, r, r_err;
+    erf_small_hi_lo(y, zero, e, e_lo);
+    erfc_hi_lo(y, zero, n, c, c_lo);
+    two_sum(one, V(neg(scale_pow2(c, n))), r, r_err);
+    r = add(r, sub(r_err, scale_pow2(c_lo, n)));
+    r = blend(add(e, e_lo), r, cmp_lt(y, y_small));
+    r = bit_or(r, bit_and(x, sign_mask));
+    return blend(x, r, isnan(x));
+}
+
+/*  Abramowitz and Stegun, formula 7.1.26. The absolute error of the
+    approximation is below 1.5e-7.
+*/
+template<class V> SIMDPP_INL
+V erf_fast_abs(const V& a)
+{
+    V one = make_float(1.0);
+    V p = make_float(0.3275911);
+    V t = div(one, mul_add(p, a, one));
+    V q = horner(t, 0.254829592, -0.284496736, 1.421413741, -1.453152027, 1.061405429);
+    V e = v_exp_fast(V(neg(mul(a, a))));
+    return sub(one, mul(mul(q, t), e));
+}
+
+template<class V> SIMDPP_INL
+V v_erf(const V& x, simdpp::math::fast)
+{
+    V sign_mask = make_float(-0.0);
+    return bit_or(erf_fast_abs(V(abs(x))), bit_and(x, sign_mask));
+}
+
+/*  gelu(x) = x/2 * (1 + erf(x/sqrt(2))). For large |x| the result is computed
+    as x - x/2 * erfc(y) or x/2 * erfc(y), y = |x|/sqrt(2), depending on the
+    sign, which avoids the cancellation for negative arguments. y is computed
+    in double-word precision, since the relative error of erfc(y) is about
+    2*y^2 times the relative error of y. The result is negative for all
+    negative arguments, thus the sign of x can be applied unconditionally.
+*/
+template<class V> SIMDPP_INL
+V gelu_kernel(const V& x)
+{
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V half = make_float(0.5);
+    V y_small = make_float(C::y_small());
+    V x_max = make_float(C::gelu_x_max());
+    V rsqrt2_hi = make_float(C::rsqrt2_hi());
+    V rsqrt2_lo = make_float(C::rsqrt2_lo());
+    V sign_mask = make_float(-0.0);
+
+    V a = min(abs(x), x_max);
+    V yh, yl;
+    two_prod(a, rsqrt2_hi, yh, yl);
+    yl = mul_add(a, rsqrt2_lo, yl);
+    V half_a = mul(a, half);
+    V e, c;
+    erf_erfc_kernel(yh, yl, half_a, e, c);
+
+    V half_x = mul(x, half);
+    V r_small = mul_add(half_a, e, half_x);
+    V r_large = blend(c, sub(x, c), cmp_lt(x, zero));
+    V r = blend(r_small, r_large, cmp_lt(yh, y_small));
+    r = bit_or(r, bit_and(x, sign_mask));
+    return blend(x, r, isnan(x));
+}
+
+/*  The kernel has an error of up to 6 ULP, thus float32 is computed in
+    double precision for both the ulp1 and ulp4 tiers.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_gelu(const float32<N>& x, simdpp::math::ulp1)
+{
+    return to_float32(gelu_kernel(to_float64(x)));
+}
+
+/*  Same as gelu_kernel(), except that erf(y) and erfc(y) are computed in
+    double-word precision and so are the final products and sums.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_gelu(const float64<N>& x, simdpp::math::ulp1)
+{
+    using V = float64<N>;
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V half = make_float(0.5);
+    V y_small = make_float(C::y_small());
+    V x_max = make_float(C::gelu_x_max());
+    V rsqrt2_hi = make_float(C::rsqrt2_hi());
+    V rsqrt2_lo = make_float(C::rsqrt2_lo());
+    V sign_mask = make_float(-0.0);
+
+    V a = min(abs(x), x_max);
+    V yh, yl;
+    two_prod(a, rsqrt2_hi, yh, yl);
+    yl = mul_add(a, rsqrt2_lo, yl);
+    V half_a = mul(a, half);
+
+    // x/2 + |x|/2 * erf(y)
+    V e, e_lo, p, p_err, s, s_err;
+    erf_small_hi_lo(yh, yl, e, e_lo);
+    two_prod(half_a, e, p, p_err);
+    two_sum(V(mul(x, half)), p, s, s_err);
+    V r_small = add(s, mul_add(half_a, e_lo, add(s_err, p_err)));
+
+    // |x|/2 * erfc(y) for negative x, |x| - |x|/2 * erfc(y) otherwise
+    V n, c, c_lo;
+    erfc_hi_lo(yh, yl, n, c, c_lo);
+    two_prod(half_a, c, p, p_err);
+    p_err = mul_add(half_a, c_lo, p_err);
+    V r_neg = scale_pow2(V(add(p, p_err)), n);
+    two_sum(a, V(neg(scale_pow2(p, n))), s, s_err);
+    V r_pos = add(s, sub(s_err, scale_pow2(p_err, n)));
+
+    V r_large = blend(r_neg, r_pos, cmp_lt(x, zero));
+    V r = blend(r_small, r_large, cmp_lt(yh, y_small));
+    r = bit_or(r, bit_and(x, sign_mask));
+    r = blend(x, r, cmp_gt(x, x_max));
+    return blend(x, r, isnan(x));
+}
+
+template<class V> SIMDPP_INL
+V v_gelu(const V& x, simdpp::math::fast)
+{
+    V one = make_float(1.0);
+    V half = make_float(0.5);
+    V rsqrt2 = make_float(0.70710678118654752440);
+    V neg_inf = make_float(-std::numeric_limits<double>::infinity());
+    V sign_mask = make_float(-0.0);
+
+    V e = erf_fast_abs(V(mul(abs(x), rsqrt2)));
+    e = bit_or(e, bit_and(x, sign_mask));
+    V r = mul(mul(x, half), add(one, e));
+    return blend(sign_mask, r, cmp_eq(x, neg_inf));
+}
+
+/*  gelu_tanh(x) = x/2 * (1 + tanh(u)) = x * sigmoid(v) where
+    v = 2u = x * (k1 + k2 * x^2). v is computed in double-word precision,
+    since the relative error of sigmoid(v) is about |v| times the relative
+    error of v for negative arguments.
+*/
+template<class V> SIMDPP_INL
+void gelu_tanh_arg(const V& x, V& vh, V& vl)
+{
+    using C = erf_consts<V>;
+    V k1_hi = make_float(C::k1_hi());
+    V k1_lo = make_float(C::k1_lo());
+    V k2_hi = make_float(C::k2_hi());
+    V k2_lo = make_float(C::k2_lo());
+
+    V sh, sl, ph, pl, wh, wl;
+    two_prod(x, x, sh, sl);
+    two_prod(k2_hi, sh, ph, pl);
+    pl = mul_add(k2_hi, sl, mul_add(k2_lo, sh, pl));
+    two_sum(k1_hi, ph, wh, wl);
+    wl = add(wl, add(pl, k1_lo));
+    two_prod(x, wh, vh, vl);
+    vl = mul_add(x, wl, vl);
+}
+
+// As in sigmoid(), exp(-|v|) is used for both signs of v
+template<class V> SIMDPP_INL
+V gelu_tanh_kernel(const V& x)
+{
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V x_max = make_float(C::gelu_tanh_x_max());
+
+    V xc = min(max(x, V(neg(x_max))), x_max);
+    V vh, vl;
+    gelu_tanh_arg(xc, vh, vl);
+
+    // exp(-|vh + vl|) = exp(-|vh|) * (1 -+ vl)
+    auto is_neg = cmp_lt(vh, zero);
+    vl = blend(vl, V(neg(vl)), is_neg);
+    V n, p;
+    exp_split(V(neg(abs(vh))), n, p);
+    p = mul_add(p, vl, p);
+    V d = add(one, scale_pow2(p, n));
+    V r = blend(div(scale_pow2(mul(p, xc), n), d), div(x, d), is_neg);
+    return blend(x, r, isnan(x));
+}
+
+// As in sigmoid(), float32 is computed in double precision for ulp1
+template<unsigned N> SIMDPP_INL
+float32<N> v_gelu_tanh(const float32<N>& x, simdpp::math::ulp1)
+{
+    return to_float32(gelu_tanh_kernel(to_float64(x)));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_gelu_tanh(const float32<N>& x, simdpp::math::ulp4)
+{
+    return gelu_tanh_kernel(x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_gelu_tanh(const float64<N>& x, simdpp::math::ulp4)
+{
+    return gelu_tanh_kernel(x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_gelu_tanh(const float64<N>& x, simdpp::math::ulp1)
+{
+    using V = float64<N>;
+    V zero = make_zero();
+    V x_max = make_float(erf_consts<V>::gelu_tanh_x_max());
+
+    V xc = min(max(x, V(neg(x_max))), x_max);
+    V vh, vl;
+    gelu_tanh_arg(xc, vh, vl);
+    V r = mul_sigmoid_hi_lo(xc, vh, vl);
+    r = blend(x, r, bit_or(cmp_gt(x, x_max), cmp_eq(x, zero)));
+    return blend(x, r, isnan(x));
+}
+
+template<class V> SIMDPP_INL
+V v_gelu_tanh(const V& x, simdpp::math::fast)
+{
+    using C = erf_consts<V>;
+    V zero = make_zero();
+    V one = make_float(1.0);
+    V x_max = make_float(C::gelu_tanh_x_max());
+    V k1 = make_float(C::k1_hi());
+    V k2 = make_float(C::k2_hi());
+
+    V xc = min(max(x, V(neg(x_max))), x_max);
+    V v = mul(xc, mul_add(k2, mul(xc, xc), k1));
+    V e = v_exp_fast(V(neg(abs(v))));
+    V d = add(one, e);
+    V r = blend(div(mul(xc, e), d), div(x, d), cmp_lt(v, zero));
+    return blend(x, r, isnan(x));
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates the hyperbolic tangent of @a x.
+
+    With the @c math::ulp1 and @c math::ulp4 tags the maximum error is 1 ULP
+    over the entire range. NaN is returned if the argument is NaN.
+
+    With the @c math::fast tag the result is computed as (1 - e) / (1 + e),
+    e = exp(-2|x|) using a reduced accuracy exponential. The absolute error
+    is below 3e-7, thus the relative error is large for arguments close to
+    zero.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> tanh(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tanh(x, tag);
+}
+
+/** Calculates the hyperbolic tangent of @a x.
+
+    With the @c math::ulp1 and @c math::ulp4 tags the maximum error is 1 ULP
+    over the entire range. With the @c math::fast tag the absolute error is
+    below 5e-14. Special cases are handled the same way as in the float32
+    version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> tanh(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tanh(x, tag);
+}
+
+/** Calculates the logistic function 1 / (1 + exp(-x)).
+
+    With the @c math::ulp1 tag the computation is done in float64 precision
+    and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the computation is done in float32 precision and the
+    maximum error is 2 ULP. NaN is returned if the argument is NaN.
+
+    With the @c math::fast tag a reduced accuracy exponential is used. The
+    absolute error is below 2e-7 and the relative error is below 1e-6 for
+    arguments above -87. The results for smaller arguments are not rounded
+    towards zero, but are below 2e-38.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> sigmoid(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_sigmoid(x, tag);
+}
+
+/** Calculates the logistic function 1 / (1 + exp(-x)).
+
+    With the @c math::ulp1 tag the quotient is computed in double-word
+    precision and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the maximum error is 2 ULP. With the @c math::fast tag
+    the absolute error is below 2e-14 and the relative error is below 1e-13
+    for arguments above -708. Special cases are handled the same way as in
+    the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> sigmoid(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_sigmoid(x, tag);
+}
+
+/** Calculates the error function of @a x.
+
+    With the @c math::ulp1 tag the computation is done in float64 precision
+    and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the computation is done in float32 precision and the
+    maximum error is 2 ULP. NaN is returned if the argument is NaN.
+
+    With the @c math::fast tag the Abramowitz and Stegun approximation 7.1.26
+    is used. The absolute error is below 6e-7, thus the relative error is
+    large for arguments close to zero.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> erf(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_erf(x, tag);
+}
+
+/** Calculates the error function of @a x.
+
+    With the @c math::ulp1 tag the polynomials are evaluated in double-word
+    precision and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the maximum error is 2 ULP. With the @c math::fast tag
+    the absolute error is below 1.5e-7, which is the error of the
+    approximation itself. Special cases are handled the same way as in the
+    float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> erf(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_erf(x, tag);
+}
+
+/** Calculates the Gaussian error linear unit x/2 * (1 + erf(x/sqrt(2))).
+
+    With the @c math::ulp1 and @c math::ulp4 tags the computation is done in
+    float64 precision and the maximum error is 1 ULP over the entire range,
+    including the negative arguments for which the result is close to zero.
+    NaN is returned if the argument is NaN.
+
+    With the @c math::fast tag erf() with the @c math::fast tag is used. The
+    absolute error is below 1e-6 * |x|.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> gelu(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_gelu(x, tag);
+}
+
+/** Calculates the Gaussian error linear unit x/2 * (1 + erf(x/sqrt(2))).
+
+    With the @c math::ulp1 and @c math::ulp4 tags erf(y) and erfc(y) and the
+    final products are computed in double-word precision and the maximum
+    error is 1 ULP over the entire range, including the negative arguments
+    for which the result is close to zero. With the @c math::fast tag the
+    absolute error is below 1e-7 * |x|. Special cases are handled the same
+    way as in the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> gelu(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_gelu(x, tag);
+}
+
+/** Calculates the tanh approximation of the Gaussian error linear unit:
+    x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 * x^3))).
+
+    With the @c math::ulp1 tag the computation is done in float64 precision
+    and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the computation is done in float32 precision and the
+    maximum error is 4 ULP, including the negative arguments for which the
+    result is close to zero. NaN is returned if the argument is NaN.
+
+    With the @c math::fast tag the result is computed as x * sigmoid(2u) with
+    the polynomial in single precision and a reduced accuracy exponential. The
+    absolute error is below 1e-6 * max(1, |x|).
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> gelu_tanh(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_gelu_tanh(x, tag);
+}
+
+/** Calculates the tanh approximation of the Gaussian error linear unit:
+    x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 * x^3))).
+
+    With the @c math::ulp1 tag the quotient is computed in double-word
+    precision and the maximum error is 1 ULP over the entire range. With the
+    @c math::ulp4 tag the maximum error is 3 ULP. With the @c math::fast tag
+    the absolute error is below 1e-14 * max(1, |x|). Special cases are
+    handled the same way as in the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> gelu_tanh(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_gelu_tanh(x, tag);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,234 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_DETAIL_MATH_UTIL_H
+#define LIBSIMDPP_SIMDPP_MATH_DETAIL_MATH_UTIL_H
+
+#include <simdpp/simd.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Computes a * b + c. The operation is fused on architectures that support
+    fmadd(), otherwise the product is rounded before the addition.
+*/
+template<class V> SIMDPP_INL
+V mul_add(const V& a, const V& b, const V& c)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+/*  Evaluates the polynomial c0 + c1*x + c2*x^2 + ... using Horner's scheme.
+    The coefficients are given starting from the constant term.
+*/
+template<class V> SIMDPP_INL
+V horner(const V&, double c0)
+{
+    V r = make_float(c0);
+    return r;
+}
+
+template<class V, class... Cs> SIMDPP_INL
+V horner(const V& x, double c0, Cs... cs)
+{
+    V c = make_float(c0);
+    return mul_add(horner(x, cs...), x, c);
+}
+
+/*  Computes s = a + b and the rounding error of the addition so that
+    s + err == a + b exactly. The magnitudes of the arguments may be in any
+    order.
+*/
+template<class V> SIMDPP_INL
+void two_sum(const V& a, const V& b, V& s, V& err)
+{
+    s = add(a, b);
+    V bb = sub(s, a);
+    err = add(sub(a, sub(s, bb)), sub(b, bb));
+}
+
+/*  Splits @a x into hi + lo so that both parts have at most half of the
+    mantissa bits and thus products of the parts are exact (Veltkamp's
+    splitting). The magnitude of @a x must be well below the maximum
+    representable value.
+*/
+template<unsigned N> SIMDPP_INL
+void split_hi_lo(const float32<N>& x, float32<N>& hi, float32<N>& lo)
+{
+    float32<N> c = make_float(4097.0f); // 2^12 + 1
+    float32<N> t = mul(x, c);
+    hi = sub(t, sub(t, x));
+    lo = sub(x, hi);
+}
+
+template<unsigned N> SIMDPP_INL
+void split_hi_lo(const float64<N>& x, float64<N>& hi, float64<N>& lo)
+{
+    float64<N> c = make_float(134217729.0); // 2^27 + 1
+    float64<N> t = mul(x, c);
+    hi = sub(t, sub(t, x));
+    lo = sub(x, hi);
+}
+
+/*  Computes p = a * b and the rounding error of the multiplication so that
+    p + err == a * b exactly, unless the product underflows. The error is
+    computed by a fused multiply-add where available and by Dekker's algorithm
+    otherwise. The outputs must not alias the inputs.
+*/
+template<class V> SIMDPP_INL
+void two_prod(const V& a, const V& b, V& p, V& err)
+{
+    p = mul(a, b);
+#if SIMDPP_USE_NULL || SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    err = mul_add(a, b, V(neg(p)));
+#else
+    V a_hi, a_lo, b_hi, b_lo;
+    split_hi_lo(a, a_hi, a_lo);
+    split_hi_lo(b, b_hi, b_lo);
+    err = sub(mul(a_hi, b_hi), p);
+    err = add(err, mul(a_hi, b_lo));
+    err = add(err, mul(a_lo, b_hi));
+    err = add(err, mul(a_lo, b_lo));
+#endif
+}
+
+/*  Performs a step of the compensated Horner scheme: computes
+    (hi + lo) * x + c, accumulating the rounding errors into @a lo. A
+    polynomial evaluated this way is almost as accurate as if the computation
+    was done with twice the precision.
+*/
+template<class V> SIMDPP_INL
+void horner_step_hi_lo(V& hi, V& lo, const V& x, const V& c)
+{
+    V p, p_err, s_err;
+    two_prod(hi, x, p, p_err);
+    two_sum(p, c, hi, s_err);
+    lo = mul_add(lo, x, add(p_err, s_err));
+}
+
+/*  Computes (ah + al) / (bh + bl) rounded to the working precision. The
+    quotient of the high parts is corrected by the remainder, whose leading
+    part is computed exactly. The low parts must be small corrections to the
+    respective high parts.
+*/
+template<class V> SIMDPP_INL
+V div_hi_lo(const V& ah, const V& al, const V& bh, const V& bl)
+{
+    V q = div(ah, bh);
+    V p, p_err;
+    two_prod(q, bh, p, p_err);
+    V r = sub(sub(ah, p), p_err);
+    r = sub(add(r, al), mul(q, bl));
+    return add(q, div(r, bh));
+}
+
+/*  Rounds to the nearest integer, ties to even. The magnitude of the argument
+    must be less than 2^22 for float32 and 2^51 for float64. Adding 1.5*2^23
+    (1.5*2^52) moves the integral part to the low bits of the mantissa, which
+    also makes the integer readily accessible via bit_cast.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> round_small(const float32<N>& x)
+{
+    float32<N> shifter = make_float(12582912.0f);
+    return sub(add(x, shifter), shifter);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> round_small(const float64<N>& x)
+{
+    float64<N> shifter = make_float(6755399441055744.0);
+    return sub(add(x, shifter), shifter);
+}
+
+/*  Computes 2^n for an integral @a n which is within the range of normal
+    exponents, i.e. [-126, 127] for float32 and [-1022, 1023] for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> pow2i(const float32<N>& n)
+{
+    float32<N> shifter = make_float(12582912.0f);
+    uint32<N> bias = make_uint(127);
+    // only the low 9 bits of the mantissa survive the shift
+    uint32<N> bits = bit_cast<uint32<N>>(add(n, shifter));
+    return bit_cast<float32<N>>(shift_l<23>(add(bits, bias)));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> pow2i(const float64<N>& n)
+{
+    float64<N> shifter = make_float(6755399441055744.0);
+    uint64<N> bias = make_uint(1023);
+    uint64<N> bits = bit_cast<uint64<N>>(add(n, shifter));
+    return bit_cast<float64<N>>(shift_l<52>(add(bits, bias)));
+}
+
+/*  Computes x * 2^n for an integral @a n. The scaling is done in two steps so
+    that the results which overflow or are subnormal are rounded correctly.
+    @a n must be within [-2*126, 2*127] for float32 and [-2*1022, 2*1023] for
+    float64.
+*/
+template<class V> SIMDPP_INL
+V scale_pow2(const V& x, const V& n)
+{
+    V half = make_float(0.5);
+    V n1 = round_small(mul(n, half));
+    V n2 = sub(n, n1);
+    return mul(mul(x, pow2i(n1)), pow2i(n2));
+}
+
+/*  Splits a positive finite normal @a x into the exponent @a e and the
+    mantissa @a m so that x = m * 2^e. The mantissa is within [lo, 2*lo) where
+    @a lo_bits is the bit pattern of lo, which must be within (0.5, 1.0].
+    Adding the difference between the bit patterns of 1.0 and lo moves the
+    values at or above lo into the next binade, after which the exponent and
+    the mantissa can be extracted as usual.
+*/
+template<unsigned N> SIMDPP_INL
+void frexp_positive(const float32<N>& x, uint32_t lo_bits,
+                    float32<N>& e, float32<N>& m)
+{
+    uint32<N> mantissa_mask = make_uint(0x007fffff);
+    uint32<N> lo = make_uint(lo_bits);
+    uint32<N> offset = make_uint(0x3f800000 - lo_bits);
+    uint32<N> bits = add(bit_cast<uint32<N>>(x), offset);
+    int32<N> exponent = bit_cast<int32<N>>(shift_r<23>(bits));
+    e = to_float32(sub(exponent, 127));
+    m = bit_cast<float32<N>>(add(bit_and(bits, mantissa_mask), lo));
+}
+
+/*  The float64 version converts the exponent by placing it into the mantissa
+    of 2^52, since 64-bit integer to float conversion is not available on most
+    architectures.
+*/
+template<unsigned N> SIMDPP_INL
+void frexp_positive(const float64<N>& x, uint64_t lo_bits,
+                    float64<N>& e, float64<N>& m)
+{
+    uint64<N> mantissa_mask = make_uint(0x000fffffffffffff);
+    uint64<N> lo = make_uint(lo_bits);
+    uint64<N> offset = make_uint(0x3ff0000000000000 - lo_bits);
+    uint64<N> two_pow_52 = make_uint(0x4330000000000000);
+    float64<N> exponent_bias = make_float(4503599627371519.0); // 2^52 + 1023
+    uint64<N> bits = add(bit_cast<uint64<N>>(x), offset);
+    uint64<N> exponent = bit_or(shift_r<52>(bits), two_pow_52);
+    e = sub(bit_cast<float64<N>>(exponent), exponent_bias);
+    m = bit_cast<float64<N>>(add(bit_and(bits, mantissa_mask), lo));
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
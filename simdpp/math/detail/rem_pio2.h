@@ -0,0 +1,204 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_DETAIL_REM_PIO2_H
+#define LIBSIMDPP_SIMDPP_MATH_DETAIL_REM_PIO2_H
+
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Returns 32 bits of the binary expansion of 2/pi starting at the bit with
+    weight 2^-pos. The table covers the bits needed to reduce any finite
+    float64 argument.
+*/
+static inline uint32_t two_over_pi_bits(int pos)
+{
+    static const uint32_t table[] = {
+        0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599,
+        0x3c439041, 0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0,
+        0x06492eea, 0x09d1921c, 0xfe1deb1c, 0xb129a73e, 0xe88235f5,
+        0x2ebb4484, 0xe99c7026, 0xb45f7e41, 0x3991d639, 0x835339f4,
+        0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f, 0xef2f118b,
+        0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+        0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1,
+        0x1f8d5d08, 0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d,
+    };
+    int idx = (pos - 1) / 32;
+    int shift = (pos - 1) % 32;
+    if (shift == 0) {
+        return table[idx];
+    }
+    return (table[idx] << shift) | (table[idx + 1] >> (32 - shift));
+}
+
+// Multiprecision number of 256 bits stored as 32-bit limbs, least significant
+// limb first
+struct rem_pio2_num {
+    uint32_t limbs[8];
+
+    uint32_t limb(int i) const
+    {
+        return (i >= 0 && i < 8) ? limbs[i] : 0;
+    }
+
+    // Returns 64 bits starting at bit @a pos. Bits below zero read as zero
+    uint64_t bits64(int pos) const
+    {
+        int idx = pos >= 0 ? pos / 32 : -((31 - pos) / 32);
+        int shift = pos - idx * 32;
+        uint64_t lo = limb(idx) | (uint64_t(limb(idx + 1)) << 32);
+        if (shift == 0) {
+            return lo;
+        }
+        return (lo >> shift) | (uint64_t(limb(idx + 2)) << (64 - shift));
+    }
+
+    // Clears all bits at position @a pos and above
+    void truncate(int pos)
+    {
+        for (int i = 0; i < 8; ++i) {
+            int rem = pos - i * 32;
+            if (rem <= 0) {
+                limbs[i] = 0;
+            } else if (rem < 32) {
+                limbs[i] &= (uint32_t(1) << rem) - 1;
+            }
+        }
+    }
+
+    void negate()
+    {
+        uint64_t carry = 1;
+        for (int i = 0; i < 8; ++i) {
+            uint64_t t = uint64_t(~limbs[i]) + carry;
+            limbs[i] = uint32_t(t);
+            carry = t >> 32;
+        }
+    }
+
+    // Returns the position of the highest set bit or -1 if the number is zero
+    int highest_bit() const
+    {
+        for (int i = 7; i >= 0; --i) {
+            if (limbs[i] != 0) {
+                int bit = 31;
+                while (((limbs[i] >> bit) & 1) == 0) {
+                    bit--;
+                }
+                return i * 32 + bit;
+            }
+        }
+        return -1;
+    }
+};
+
+/*  Reduces a finite @a x to r + r_lo = x - k*pi/2, |r| <= pi/4 using the
+    Payne-Hanek algorithm and returns r. The low part of the result is stored
+    to @a r_lo and the quadrant k mod 4 is stored to @a quadrant.
+
+    x = m * 2^e where m is a 53-bit integer. The bits of 2/pi whose product
+    with x is a multiple of 4 do not affect the result, thus only a window of
+    192 bits is multiplied by m. This gives at least 190 bits of the fraction,
+    which is sufficient even for the arguments closest to a multiple of pi/2.
+
+    This is a scalar function that is used for the elements whose magnitude
+    is too large for the Cody-Waite reduction.
+*/
+static inline double rem_pio2_large(double x, double& r_lo, int& quadrant)
+{
+    double ax = std::fabs(x);
+    uint64_t bits;
+    std::memcpy(&bits, &ax, sizeof(bits));
+    int exponent = int(bits >> 52) - 1075;
+    uint64_t m = (bits & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+    if ((bits >> 52) == 0) {
+        // subnormals never reach this function, but handle them for safety
+        m = bits & 0x000fffffffffffffULL;
+        exponent = -1074;
+    }
+
+    int first_bit = exponent - 1 > 1 ? exponent - 1 : 1;
+    uint32_t w[6];
+    for (int i = 0; i < 6; ++i) {
+        // w[0] is the least significant limb
+        w[i] = two_over_pi_bits(first_bit + 32 * (5 - i));
+    }
+
+    rem_pio2_num p;
+    std::memset(p.limbs, 0, sizeof(p.limbs));
+    uint32_t ml[2] = { uint32_t(m), uint32_t(m >> 32) };
+    for (int i = 0; i < 6; ++i) {
+        uint64_t carry = 0;
+        for (int k = 0; k < 2; ++k) {
+            uint64_t t = uint64_t(w[i]) * ml[k] + p.limbs[i + k] + carry;
+            p.limbs[i + k] = uint32_t(t);
+            carry = t >> 32;
+        }
+        for (int k = i + 2; carry != 0 && k < 8; ++k) {
+            uint64_t t = uint64_t(p.limbs[k]) + carry;
+            p.limbs[k] = uint32_t(t);
+            carry = t >> 32;
+        }
+    }
+
+    // x * 2/pi = p * 2^-frac_bits
+    int frac_bits = first_bit + 191 - exponent;
+    int n = int(p.bits64(frac_bits) & 3);
+    p.truncate(frac_bits);
+
+    // round to the nearest quadrant so that |r| <= pi/4
+    bool upper_half = ((p.bits64(frac_bits - 1) & 1) != 0);
+    if (upper_half) {
+        n++;
+        p.negate();
+        p.truncate(frac_bits);
+    }
+
+    double r = 0;
+    r_lo = 0;
+    int top = p.highest_bit();
+    if (top >= 0) {
+        // split the leading 128 bits into a 53-bit head and the rest
+        uint64_t hi = p.bits64(top - 63);
+        uint64_t lo = p.bits64(top - 127);
+        int scale = top - 63 - frac_bits;
+        double f_hi = std::ldexp(double(hi & ~uint64_t(0x7ff)), scale);
+        double f_lo = std::ldexp(double(hi & 0x7ff) + std::ldexp(double(lo), -64), scale);
+
+        const double pio2_hi = 1.570796326794896557999e+00;
+        const double pio2_lo = 6.123233995736766035869e-17;
+        // the rounding error of the leading product is recovered exactly
+        double p_hi = f_hi * pio2_hi;
+        double p_err = std::fma(f_hi, pio2_hi, -p_hi);
+        double tail = p_err + (f_hi * pio2_lo + f_lo * pio2_hi);
+        r = p_hi + tail;
+        r_lo = tail - (r - p_hi);
+    }
+    if (upper_half != (x < 0)) {
+        r = -r;
+        r_lo = -r_lo;
+    }
+    if (x < 0) {
+        n = -n;
+    }
+    quadrant = n & 3;
+    return r;
+}
+
+} // namespace math
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,425 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_MATH_EXP_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/detail/math_util.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Reduces the argument of exp(x) to r = x - n*ln(2) where n = round(x/ln(2)),
+    |r| <= ln(2)/2. ln(2) is split into two parts, the high part having enough
+    trailing zero bits for n*ln2_hi to be exact.
+*/
+template<unsigned N> SIMDPP_INL
+void exp_reduce(const float32<N>& x, float32<N>& n, float32<N>& r)
+{
+    float32<N> log2e = make_float(1.44269504088896341f);
+    float32<N> neg_ln2_hi = make_float(-0.693359375f);
+    float32<N> neg_ln2_lo = make_float(2.12194440e-4f);
+    n = round_small(mul(x, log2e));
+    r = mul_add(n, neg_ln2_hi, x);
+    r = mul_add(n, neg_ln2_lo, r);
+}
+
+template<unsigned N> SIMDPP_INL
+void exp_reduce(const float64<N>& x, float64<N>& n, float64<N>& r)
+{
+    float64<N> log2e = make_float(1.44269504088896338700e+00);
+    float64<N> neg_ln2_hi = make_float(-6.93147180369123816490e-01);
+    float64<N> neg_ln2_lo = make_float(-1.90821492927058770002e-10);
+    n = round_small(mul(x, log2e));
+    r = mul_add(n, neg_ln2_hi, x);
+    r = mul_add(n, neg_ln2_lo, r);
+}
+
+/*  Same as exp_reduce(), except that the argument is x + x_lo and the reduced
+    argument is computed in double-word precision as r + r_lo. x_lo must be
+    a small correction to x.
+*/
+template<unsigned N> SIMDPP_INL
+void exp_reduce_hi_lo(const float64<N>& x, const float64<N>& x_lo,
+                      float64<N>& n, float64<N>& r, float64<N>& r_lo)
+{
+    float64<N> log2e = make_float(1.44269504088896338700e+00);
+    float64<N> neg_ln2_hi = make_float(-6.93147180369123816490e-01);
+    float64<N> ln2_lo = make_float(1.90821492927058770002e-10);
+    n = round_small(mul(x, log2e));
+
+    // x - n*ln2_hi is exact, the product with the low part is split into
+    // the rounded result and the error. The sum is renormalized at the end,
+    // since x_lo may be much larger than the rounding error of r.
+    float64<N> t = mul_add(n, neg_ln2_hi, x);
+    float64<N> p, p_err, s, s_err;
+    two_prod(n, ln2_lo, p, p_err);
+    two_sum(t, float64<N>(neg(p)), s, s_err);
+    two_sum(s, float64<N>(add(sub(s_err, p_err), x_lo)), r, r_lo);
+}
+
+/*  Computes exp(r) - 1 for |r| <= ln(2)/2 as r + r^2 * P(r). The polynomials
+    are minimax approximations of the relative error of P.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> expm1_reduced(const float32<N>& r)
+{
+    float32<N> p = horner(r, 5.000000013e-01, 1.666666653e-01, 4.166646547e-02,
+                          8.333360723e-03, 1.393360440e-03, 1.985780221e-04);
+    return mul_add(p, mul(r, r), r);
+}
+
+/*  The float64 polynomial is split as P(r) = 1/2 + r * P3(r), which is shared
+    with expm1_reduced_hi_lo().
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> expm1_poly3(const float64<N>& r)
+{
+    return horner(r, 1.66666666666666709657e-01, 4.16666666666666184089e-02,
+                  8.33333333332616308619e-03, 1.38888888889179742557e-03,
+                  1.98412698747361131138e-04, 2.48015872457193815788e-05,
+                  2.75572554947960359005e-06, 2.75573496265816442336e-07,
+                  2.51051817204253511056e-08, 2.08893765109735652923e-09);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> expm1_reduced(const float64<N>& r)
+{
+    float64<N> half = make_float(0.5);
+    float64<N> p = mul_add(expm1_poly3(r), r, half);
+    return mul_add(p, mul(r, r), r);
+}
+
+/*  Computes exp(r + r_lo) - 1 = q + q_lo for |r| <= ln(2)/2 using the
+    polynomial of expm1_reduced(). r + r^2/2 is computed exactly, the
+    remaining terms contribute less than 1/40 of the result, thus their
+    rounding errors are insignificant.
+*/
+template<unsigned N> SIMDPP_INL
+void expm1_reduced_hi_lo(const float64<N>& r, const float64<N>& r_lo,
+                         float64<N>& q, float64<N>& q_lo)
+{
+    float64<N> one = make_float(1.0);
+    float64<N> half = make_float(0.5);
+    float64<N> p = expm1_poly3(r);
+    float64<N> z, z_err, s, s_err;
+    two_prod(r, r, z, z_err);
+    two_sum(r, float64<N>(mul(z, half)), s, s_err);
+
+    // exp(r + r_lo) - 1 = expm1(r) + r_lo * (1 + r) approximately
+    float64<N> tail = mul_add(mul(r, z), p, mul_add(r_lo, add(r, one), s_err));
+    tail = mul_add(z_err, half, tail);
+    two_sum(s, tail, q, q_lo);
+}
+
+/*  Computes 2^r - 1 for |r| <= 0.5 as r * P(r).
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> exp2m1_reduced(const float32<N>& r)
+{
+    float32<N> p = horner(r, 6.931471879e-01, 2.402264979e-01, 5.550357434e-02,
+                          9.618237493e-03, 1.339073548e-03, 1.540351291e-04);
+    return mul(p, r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> exp2m1_reduced(const float64<N>& r)
+{
+    float64<N> p = horner(r, 6.93147180559945309256e-01, 2.40226506959100712856e-01,
+                          5.55041086648216265430e-02, 9.61812910762843694698e-03,
+                          1.33335581464066297370e-03, 1.54035303934661716178e-04,
+                          1.52527338413785238580e-05, 1.32154867213546329858e-06,
+                          1.01780571692616426727e-07, 7.05493227352668854665e-09,
+                          4.45580485860363484773e-10, 2.56784258737789145177e-11);
+    return mul(p, r);
+}
+
+/*  Computes exp(r) - 1 for |r| <= ln(2)/2 as r + r^2 * P(r) with lower degree
+    polynomials than expm1_reduced(). The relative error of the result is
+    below 1e-6 for float32 and 1e-13 for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> expm1_reduced_fast(const float32<N>& r)
+{
+    float32<N> p = horner(r, 4.99997501725688985220e-01, 1.66667742171401378283e-01,
+                          4.18336195379024389544e-02, 8.34126700279175790820e-03);
+    return mul_add(p, mul(r, r), r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> expm1_reduced_fast(const float64<N>& r)
+{
+    float64<N> p = horner(r, 4.99999999999553624595e-01, 1.66666666667386220824e-01,
+                          4.16666667858957399761e-02, 8.33333329350020695532e-03,
+                          1.38888391897222005493e-03, 1.98413090775520486276e-04,
+                          2.48678279229744966009e-05, 2.75773612601900659854e-06);
+    return mul_add(p, mul(r, r), r);
+}
+
+// The arguments beyond which exp() overflows to infinity and underflows to
+// zero. Clamping to these keeps n within the range accepted by scale_pow2.
+// v_exp_fast() clamps to the fast_* limits instead, which keep n within the
+// range of normal exponents.
+template<class V> struct exp_limits;
+
+template<unsigned N> struct exp_limits<float32<N>> {
+    static float min_arg() { return -104.0f; }
+    static float max_arg() { return 89.0f; }
+    static float min_arg2() { return -152.0f; }
+    static float max_arg2() { return 129.0f; }
+    // exp(x) - 1 == -1 and 2^n - 1 is exact for n below this
+    static float expm1_max_n() { return 64.0f; }
+    static float fast_min_arg() { return -87.0f; }
+    static float fast_max_arg() { return 88.0f; }
+};
+
+template<unsigned N> struct exp_limits<float64<N>> {
+    static double min_arg() { return -746.0; }
+    static double max_arg() { return 710.0; }
+    static double min_arg2() { return -1076.0; }
+    static double max_arg2() { return 1025.0; }
+    static double expm1_max_n() { return 512.0; }
+    static double fast_min_arg() { return -708.0; }
+    static double fast_max_arg() { return 709.0; }
+};
+
+template<class V> SIMDPP_INL
+V v_exp(const V& a)
+{
+    using L = exp_limits<V>;
+    V min_arg = make_float(L::min_arg());
+    V max_arg = make_float(L::max_arg());
+    V one = make_float(1.0);
+
+    V x = min(max(a, min_arg), max_arg);
+    V n, r;
+    exp_reduce(x, n, r);
+    V res = add(expm1_reduced(r), one);
+    res = scale_pow2(res, n);
+
+    // put back NaN if the argument was NaN
+    return blend(a, res, isnan(a));
+}
+
+/*  Computes exp(x) with reduced accuracy for use within other functions
+    where the full accuracy is not needed. The argument is clamped so that
+    the result is always finite and nonzero, and NaN is not propagated.
+*/
+template<class V> SIMDPP_INL
+V v_exp_fast(const V& a)
+{
+    using L = exp_limits<V>;
+    V min_arg = make_float(L::fast_min_arg());
+    V max_arg = make_float(L::fast_max_arg());
+    V one = make_float(1.0);
+
+    V x = min(max(a, min_arg), max_arg);
+    V n, r;
+    exp_reduce(x, n, r);
+    V res = add(expm1_reduced_fast(r), one);
+    return mul(res, pow2i(n));
+}
+
+template<class V> SIMDPP_INL
+V v_exp2(const V& a)
+{
+    using L = exp_limits<V>;
+    V min_arg = make_float(L::min_arg2());
+    V max_arg = make_float(L::max_arg2());
+    V one = make_float(1.0);
+
+    V x = min(max(a, min_arg), max_arg);
+    V n = round_small(x);
+    V r = sub(x, n);
+    V res = add(exp2m1_reduced(r), one);
+    res = scale_pow2(res, n);
+
+    return blend(a, res, isnan(a));
+}
+
+template<class V> SIMDPP_INL
+V v_expm1(const V& a)
+{
+    using L = exp_limits<V>;
+    V min_arg = make_float(L::min_arg());
+    V max_arg = make_float(L::max_arg());
+    V max_n = make_float(L::expm1_max_n());
+    V one = make_float(1.0);
+    V half = make_float(0.5);
+
+    V x = min(max(a, min_arg), max_arg);
+    V n, r;
+    exp_reduce(x, n, r);
+    V q = expm1_reduced(r);
+
+    // expm1(x) = 2^n * q + (2^n - 1). When n is large the subtraction of 1
+    // does not affect the result and 2^n may overflow, thus the result is
+    // computed the same way as exp(x).
+    V n1 = round_small(mul(n, half));
+    V s1 = pow2i(n1);
+    V s2 = pow2i(sub(n, n1));
+    V t = mul(s1, s2);
+    V res_small = mul_add(t, q, sub(t, one));
+    V res_large = mul(mul(add(q, one), s1), s2);
+    V res = blend(res_large, res_small, cmp_gt(n, max_n));
+
+    // preserve the sign of zero and put back NaN
+    V zero = make_float(0.0);
+    return blend(a, res, bit_or(isnan(a), cmp_eq(a, zero)));
+}
+
+template<class V> SIMDPP_INL
+V v_expm1(const V& a, simdpp::math::ulp4)
+{
+    return v_expm1(a);
+}
+
+/*  Same as v_expm1(), except that the intermediate results are kept in
+    double-word precision: 2^n - 1 is split into u + u_lo exactly and the
+    sum with 2^n * (q + q_lo) is rounded only once.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_expm1(const float64<N>& a, simdpp::math::ulp1)
+{
+    using V = float64<N>;
+    using L = exp_limits<V>;
+    V min_arg = make_float(L::min_arg());
+    V max_arg = make_float(L::max_arg());
+    V max_n = make_float(L::expm1_max_n());
+    V zero = make_float(0.0);
+    V one = make_float(1.0);
+    V half = make_float(0.5);
+
+    V x = min(max(a, min_arg), max_arg);
+    V n, r, r_lo, q, q_lo;
+    exp_reduce_hi_lo(x, zero, n, r, r_lo);
+    expm1_reduced_hi_lo(r, r_lo, q, q_lo);
+
+    V n1 = round_small(mul(n, half));
+    V s1 = pow2i(n1);
+    V s2 = pow2i(sub(n, n1));
+    V t = mul(s1, s2);
+    V u, u_err, h, h_err;
+    two_sum(t, V(neg(one)), u, u_err);
+    two_sum(V(mul(t, q)), u, h, h_err);
+    V res_small = add(h, mul_add(t, q_lo, add(h_err, u_err)));
+
+    // 2^n * (1 + q + q_lo) when n is large
+    V e, e_err;
+    two_sum(one, q, e, e_err);
+    V res_large = mul(mul(add(e, add(e_err, q_lo)), s1), s2);
+    V res = blend(res_large, res_small, cmp_gt(n, max_n));
+
+    return blend(a, res, bit_or(isnan(a), cmp_eq(a, zero)));
+}
+
+template<class V> SIMDPP_INL
+V v_exp(const V& a, simdpp::math::ulp1)
+{
+    return v_exp(a);
+}
+
+template<class V> SIMDPP_INL
+V v_exp(const V& a, simdpp::math::fast)
+{
+    return blend(a, v_exp_fast(a), isnan(a));
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates e raised to the power of @a x.
+
+    The accuracy is selected by the optional @a tag argument:
+     - @c math::ulp1 and @c math::ulp4: the maximum error is 1 ULP over the
+       entire range. Arguments whose result is not representable produce
+       zero or infinity.
+     - @c math::fast: a shorter polynomial is used and the relative error is
+       below 1e-6. Arguments are clamped to [-87, 88], thus the result is
+       always a finite normal number.
+
+    NaN is returned if the argument is NaN.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> exp(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_exp(x, tag);
+}
+
+/** Calculates e raised to the power of @a x.
+
+    The accuracy tiers are the same as in the float32 version. The relative
+    error of the @c math::fast tier is below 1e-13 and the arguments are
+    clamped to [-708, 709]. Special cases are handled the same way as in the
+    float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> exp(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_exp(x, tag);
+}
+
+/** Calculates 2 raised to the power of @a x.
+
+    The maximum error is 1 ULP over the entire range. Arguments whose result
+    is not representable produce zero or infinity. NaN is returned if the
+    argument is NaN. All accuracy tiers use the same implementation.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> exp2(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_exp2(x);
+}
+
+/** Calculates 2 raised to the power of @a x.
+
+    The maximum error is 1 ULP over the entire range. Special cases are
+    handled the same way as in the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> exp2(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_exp2(x);
+}
+
+/** Calculates e raised to the power of @a x, minus one. The result is
+    accurate even if @a x is close to zero.
+
+    The maximum error is 1 ULP over the entire range. The result is -1 for
+    large negative arguments and infinity if it is too large to be
+    represented. NaN is returned if the argument is NaN. All accuracy tiers
+    use the same implementation.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> expm1(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_expm1(x);
+}
+
+/** Calculates e raised to the power of @a x, minus one. The result is
+    accurate even if @a x is close to zero.
+
+    With the @c math::ulp1 tag the reduced argument and the polynomial are
+    evaluated in double-word precision and the maximum error is 1 ULP over
+    the entire range. With the @c math::ulp4 and @c math::fast tags the
+    maximum error is 2 ULP. Special cases are handled the same way as in the
+    float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> expm1(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_expm1(x, tag);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,423 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_FREXP_H
+#define LIBSIMDPP_SIMDPP_MATH_FREXP_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/detail/math_util.h>
+#include <simdpp/detail/vector_array_macros.h>
+#include <cstdint>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Scales subnormal arguments into the normal range so that the exponent and
+    the mantissa can be extracted from the bit pattern. @a adj is set to the
+    number of binades the argument has been scaled by.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> normalize_subnormal(const float32<N>& x, float32<N>& adj)
+{
+    float32<N> min_normal = make_float(std::numeric_limits<float>::min());
+    float32<N> two_pow_25 = make_float(33554432.0f);
+    float32<N> adj25 = make_float(25.0f);
+    mask_float32<N> is_sub = cmp_lt(abs(x), min_normal);
+    adj = bit_and(adj25, is_sub);
+    return blend(mul(x, two_pow_25), x, is_sub);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> normalize_subnormal(const float64<N>& x, float64<N>& adj)
+{
+    float64<N> min_normal = make_float(std::numeric_limits<double>::min());
+    float64<N> two_pow_54 = make_float(18014398509481984.0);
+    float64<N> adj54 = make_float(54.0);
+    mask_float64<N> is_sub = cmp_lt(abs(x), min_normal);
+    adj = bit_and(adj54, is_sub);
+    return blend(mul(x, two_pow_54), x, is_sub);
+}
+
+// Computes floor(log2(|x|)) of finite nonzero @a x as a floating-point value
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_getexp(const float32<N>& x)
+{
+    float32<N> adj;
+    float32<N> xs = normalize_subnormal(x, adj);
+    uint32<N> exp_mask = make_uint(0x7f800000);
+    float32<N> bias = make_float(127.0f);
+    int32<N> e = shift_r<23>(bit_and(bit_cast<uint32<N>>(xs), exp_mask));
+    return sub(to_float32(e), add(bias, adj));
+}
+
+/*  The exponent is converted by placing it into the mantissa of 2^52, since
+    64-bit integer to float conversion is not available on most architectures.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_emul_getexp(const float64<N>& x)
+{
+    float64<N> adj;
+    float64<N> xs = normalize_subnormal(x, adj);
+    uint64<N> exp_mask = make_uint(0x7ff0000000000000);
+    uint64<N> two_pow_52 = make_uint(0x4330000000000000);
+    float64<N> bias = make_float(4503599627371519.0); // 2^52 + 1023
+    uint64<N> e = bit_or(shift_r<52>(bit_and(bit_cast<uint64<N>>(xs), exp_mask)),
+                         two_pow_52);
+    return sub(bit_cast<float64<N>>(e), add(bias, adj));
+}
+
+// Computes the mantissa of finite nonzero @a x within [0.5, 1) with its sign
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_getmant(const float32<N>& x)
+{
+    float32<N> adj;
+    float32<N> xs = normalize_subnormal(x, adj);
+    uint32<N> keep_mask = make_uint(0x807fffff);
+    uint32<N> half = make_uint(0x3f000000);
+    return bit_cast<float32<N>>(bit_or(bit_and(bit_cast<uint32<N>>(xs), keep_mask), half));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_emul_getmant(const float64<N>& x)
+{
+    float64<N> adj;
+    float64<N> xs = normalize_subnormal(x, adj);
+    uint64<N> keep_mask = make_uint(0x800fffffffffffff);
+    uint64<N> half = make_uint(0x3fe0000000000000);
+    return bit_cast<float64<N>>(bit_or(bit_and(bit_cast<uint64<N>>(xs), keep_mask), half));
+}
+
+/*  Computes x * 2^n for integral @a n as m * 2^(e + n) where m is the mantissa
+    within [0.5, 1). The new exponent is clamped so that scale_pow2() can apply
+    it: the first of its two steps keeps the result in the normal range, thus
+    overflowing and subnormal results are rounded only once. The clamped values
+    produce infinity or zero regardless of the mantissa.
+*/
+template<class V> SIMDPP_INL
+V v_emul_scalef(const V& x, const V& n, const V& min_e, const V& max_e)
+{
+    V one = make_float(1.0);
+    V e = add(v_emul_getexp(x), one);
+    e = min(max(add(e, n), min_e), max_e);
+    V res = scale_pow2(v_emul_getmant(x), e);
+
+    V zero = make_zero();
+    return blend(x, res, bit_or(cmp_eq(x, zero), bit_not(isfinite(x))));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_scalef(const float32<N>& x, const float32<N>& n)
+{
+    float32<N> min_e = make_float(-190.0f);
+    float32<N> max_e = make_float(130.0f);
+    return v_emul_scalef(x, n, min_e, max_e);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_emul_scalef(const float64<N>& x, const float64<N>& n)
+{
+    float64<N> min_e = make_float(-1100.0);
+    float64<N> max_e = make_float(1026.0);
+    return v_emul_scalef(x, n, min_e, max_e);
+}
+
+// -----------------------------------------------------------------------------
+// AVX-512 has instructions that extract the exponent and the mantissa and
+// scale by a power of two. They handle subnormals directly.
+
+static SIMDPP_INL
+float32<4> v_getexp(const float32<4>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_getexp_ps(x.native());
+#else
+    return v_emul_getexp(x);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> v_getmant(const float32<4>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_getmant_ps(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+#else
+    return v_emul_getmant(x);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> v_scalef(const float32<4>& x, const float32<4>& n)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_scalef_ps(x.native(), n.native());
+#else
+    return v_emul_scalef(x, n);
+#endif
+}
+
+static SIMDPP_INL
+float64<2> v_getexp(const float64<2>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_getexp_pd(x.native());
+#else
+    return v_emul_getexp(x);
+#endif
+}
+
+static SIMDPP_INL
+float64<2> v_getmant(const float64<2>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_getmant_pd(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+#else
+    return v_emul_getmant(x);
+#endif
+}
+
+static SIMDPP_INL
+float64<2> v_scalef(const float64<2>& x, const float64<2>& n)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_scalef_pd(x.native(), n.native());
+#else
+    return v_emul_scalef(x, n);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> v_getexp(const float32<8>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_getexp_ps(x.native());
+#else
+    return v_emul_getexp(x);
+#endif
+}
+
+static SIMDPP_INL
+float32<8> v_getmant(const float32<8>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_getmant_ps(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+#else
+    return v_emul_getmant(x);
+#endif
+}
+
+static SIMDPP_INL
+float32<8> v_scalef(const float32<8>& x, const float32<8>& n)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_scalef_ps(x.native(), n.native());
+#else
+    return v_emul_scalef(x, n);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> v_getexp(const float64<4>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_getexp_pd(x.native());
+#else
+    return v_emul_getexp(x);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> v_getmant(const float64<4>& x)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_getmant_pd(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+#else
+    return v_emul_getmant(x);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> v_scalef(const float64<4>& x, const float64<4>& n)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_scalef_pd(x.native(), n.native());
+#else
+    return v_emul_scalef(x, n);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> v_getexp(const float32<16>& x)
+{
+    return _mm512_getexp_ps(x.native());
+}
+
+static SIMDPP_INL
+float32<16> v_getmant(const float32<16>& x)
+{
+    return _mm512_getmant_ps(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+}
+
+static SIMDPP_INL
+float32<16> v_scalef(const float32<16>& x, const float32<16>& n)
+{
+    return _mm512_scalef_ps(x.native(), n.native());
+}
+
+static SIMDPP_INL
+float64<8> v_getexp(const float64<8>& x)
+{
+    return _mm512_getexp_pd(x.native());
+}
+
+static SIMDPP_INL
+float64<8> v_getmant(const float64<8>& x)
+{
+    return _mm512_getmant_pd(x.native(), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+}
+
+static SIMDPP_INL
+float64<8> v_scalef(const float64<8>& x, const float64<8>& n)
+{
+    return _mm512_scalef_pd(x.native(), n.native());
+}
+#endif
+
+template<class V> SIMDPP_INL
+V v_getexp(const V& x)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, v_getexp, x)
+}
+
+template<class V> SIMDPP_INL
+V v_getmant(const V& x)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, V, v_getmant, x)
+}
+
+template<class V> SIMDPP_INL
+V v_scalef(const V& x, const V& n)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, V, v_scalef, x, n)
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The exponent is selected in floating-point and converted at the end, so
+    that the masks of float64 vectors don't need to be converted to the
+    narrower 32-bit integer vectors.
+*/
+template<class V> SIMDPP_INL
+V v_ilogb_float(const V& x, const V& inf_value)
+{
+    V ilogb0 = make_float(-2147483648.0);
+    V inf = make_float(std::numeric_limits<double>::infinity());
+    V zero = make_zero();
+    V e = v_getexp(x);
+    e = blend(inf_value, e, cmp_eq(abs(x), inf));
+    e = blend(ilogb0, e, bit_or(cmp_eq(x, zero), isnan(x)));
+    return e;
+}
+
+} // namespace math
+} // namespace detail
+
+/** Splits @a x into the mantissa within [0.5, 1) and the exponent @a e so that
+    x = m * 2^e. The mantissa is returned and has the sign of @a x. Zero,
+    infinity and NaN are returned unchanged and @a e is set to zero in that
+    case. Subnormal arguments are supported.
+
+    On AVX-512 the @c vgetexp and @c vgetmant instructions are used.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> frexp(const float32<N>& x, int32<N>& e)
+{
+    float32<N> one = make_float(1.0f);
+    float32<N> zero = make_zero();
+    mask_float32<N> special = bit_or(cmp_eq(x, zero), bit_not(isfinite(x)));
+    e = to_int32(blend(zero, add(detail::math::v_getexp(x), one), special));
+    return blend(x, detail::math::v_getmant(x), special);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> frexp(const float64<N>& x, int32<N>& e)
+{
+    float64<N> one = make_float(1.0);
+    float64<N> zero = make_zero();
+    mask_float64<N> special = bit_or(cmp_eq(x, zero), bit_not(isfinite(x)));
+    e = to_int32(blend(zero, add(detail::math::v_getexp(x), one), special));
+    return blend(x, detail::math::v_getmant(x), special);
+}
+
+/** Computes x * 2^n. The result is rounded correctly, including overflowing
+    and subnormal results. Zero, infinity and NaN are returned unchanged.
+
+    On AVX-512 the @c vscalef instruction is used.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> ldexp(const float32<N>& x, const int32<N>& n)
+{
+    return detail::math::v_scalef(x, float32<N>(to_float32(n)));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> ldexp(const float64<N>& x, const int32<N>& n)
+{
+    return detail::math::v_scalef(x, float64<N>(to_float64(n)));
+}
+
+/** Computes x * 2^n. Since the radix of the floating-point types is 2, this is
+    the same as ldexp().
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> scalbn(const float32<N>& x, const int32<N>& n)
+{
+    return ldexp(x, n);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> scalbn(const float64<N>& x, const int32<N>& n)
+{
+    return ldexp(x, n);
+}
+
+/** Extracts the unbiased exponent of @a x, i.e. floor(log2(|x|)). Subnormal
+    arguments are supported. Zero and NaN produce INT32_MIN, infinity produces
+    INT32_MAX, which are the values of FP_ILOGB0 and FP_ILOGBNAN used by glibc
+    on x86.
+
+    On AVX-512 the @c vgetexp instruction is used.
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> ilogb(const float32<N>& x)
+{
+    // INT32_MAX is not representable in float32, thus infinity produces zero
+    // first and is replaced afterwards
+    float32<N> zero = make_zero();
+    float32<N> inf = make_float(std::numeric_limits<float>::infinity());
+    int32<N> int_max = make_int(0x7fffffff);
+    float32<N> max_bits = bit_cast<float32<N>>(int_max);
+    float32<N> e = bit_cast<float32<N>>(to_int32(detail::math::v_ilogb_float(x, zero)));
+    return bit_cast<int32<N>>(bit_or(e, bit_and(max_bits, cmp_eq(abs(x), inf))));
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> ilogb(const float64<N>& x)
+{
+    float64<N> int_max = make_float(2147483647.0);
+    return to_int32(detail::math::v_ilogb_float(x, int_max));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,465 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_INVERSE_TRIG_H
+#define LIBSIMDPP_SIMDPP_MATH_INVERSE_TRIG_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/detail/math_util.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  pio4_hi and atan_half_hi are pi/4 and atan(0.5) truncated to multiples of
+    2^-22 (2^-51 for float64). pio2_hi and pio2_lo split pi/2 into the nearest
+    representable value and the remainder. hi_mask clears the low half of the
+    mantissa so that the square of the result is exact.
+*/
+template<class V> struct inv_trig_consts;
+
+template<unsigned N> struct inv_trig_consts<float32<N>> {
+    using uint_t = uint32<N>;
+    static float pio4_hi() { return 7.85398006439209e-01f; }
+    static float pio4_lo() { return 1.5695823663008923e-07f; }
+    static float atan_half_hi() { return 4.6364760398864746e-01f; }
+    static float atan_half_lo() { return 5.01215868808913e-09f; }
+    static float pio2_hi() { return 1.5707963705062866f; }
+    static float pio2_lo() { return -4.371138828673793e-08f; }
+    static uint32_t hi_mask() { return 0xfffff000; }
+};
+
+template<unsigned N> struct inv_trig_consts<float64<N>> {
+    using uint_t = uint64<N>;
+    static double pio4_hi() { return 7.8539816339744828e-01; }
+    static double pio4_lo() { return 3.061616997868383e-17; }
+    static double atan_half_hi() { return 4.636476090008057e-01; }
+    static double atan_half_lo() { return 4.1127683607176647e-16; }
+    static double pio2_hi() { return 1.5707963267948966; }
+    static double pio2_lo() { return 6.123233995736766e-17; }
+    static uint64_t hi_mask() { return 0xffffffff00000000; }
+};
+
+/*  Computes atan(u) = u + u^3 * P(u^2) for |u| <= 7/16.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> atan_poly(const float32<N>& u, simdpp::math::ulp1)
+{
+    float32<N> z = mul(u, u);
+    float32<N> p = horner(z, -3.333333078e-01, 1.999932409e-01, -1.425681729e-01,
+                          1.067039126e-01, -6.221013082e-02);
+    return mul_add(mul(u, z), p, u);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> atan_poly(const float32<N>& u, simdpp::math::ulp4)
+{
+    float32<N> z = mul(u, u);
+    float32<N> p = horner(z, -3.333326446e-01, 1.998831706e-01, -1.397052392e-01,
+                          8.284046931e-02);
+    return mul_add(mul(u, z), p, u);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> atan_poly(const float64<N>& u, simdpp::math::ulp1)
+{
+    float64<N> z = mul(u, u);
+    float64<N> p = horner(z, -3.33333333333333329519e-01, 1.99999999999994229788e-01,
+                          -1.42857142855695729696e-01, 1.11111110968689158576e-01,
+                          -9.09090836490128752152e-02, 7.69228578035240344636e-02,
+                          -6.66624533327831912389e-02, 5.87697959116770427316e-02,
+                          -5.21688664285064396887e-02, 4.49306178267989525375e-02,
+                          -3.31457281228125458431e-02, 1.47898453122254651346e-02);
+    return mul_add(mul(u, z), p, u);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> atan_poly(const float64<N>& u, simdpp::math::ulp4)
+{
+    float64<N> z = mul(u, u);
+    float64<N> p = horner(z, -3.33333333333333239248e-01, 1.99999999999880358145e-01,
+                          -1.42857142831943982321e-01, 1.11111109035973335867e-01,
+                          -9.09090029801873462746e-02, 7.69208933587408652002e-02,
+                          -6.66326277569893144409e-02, 5.84789647377101889165e-02,
+                          -5.03470243212974731025e-02, 3.78438271225294445056e-02,
+                          -1.75666139557040694301e-02);
+    return mul_add(mul(u, z), p, u);
+}
+
+/*  Computes a / b. The float32 version of the ulp4 tier refines the
+    reciprocal estimate with two Newton-Raphson steps instead of using the
+    division. @a b must be within the range where rcp_e() produces a normal
+    result.
+*/
+template<class V> SIMDPP_INL
+V atan_div(const V& a, const V& b, simdpp::math::ulp1)
+{
+    return div(a, b);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> atan_div(const float32<N>& a, const float32<N>& b, simdpp::math::ulp4)
+{
+    float32<N> x = rcp_e(b);
+    x = rcp_rh(x, b);
+    x = rcp_rh(x, b);
+    return mul(a, x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> atan_div(const float64<N>& a, const float64<N>& b, simdpp::math::ulp4)
+{
+    return div(a, b);
+}
+
+/*  Computes k*pi/4 + atan(mn/mx), where the sign of the second term is
+    flipped if the sign bit is set in @a flip. 0 <= mn <= mx and mx must be
+    positive and finite.
+
+    The ratio is reduced so that the polynomial is evaluated within
+    [-7/16, 7/16] and the reduced term is small compared to the result:
+     - atan(mn/mx) = atan(0.5) + atan((2*mn - mx)/(2*mx + mn)) if the ratio is
+       within (7/16, 11/16]
+     - atan(mn/mx) = pi/4 + atan((mn - mx)/(mn + mx)) if the ratio exceeds
+       11/16
+    The subtractions in the numerators are exact. The high parts of the
+    constants are multiples of 2^-22 (2^-51 for float64), thus their sums
+    with the multiples of pi/4 are exact too.
+*/
+template<class V, class Tag, class DivTag> SIMDPP_INL
+V atan_reduced(const V& mn, const V& mx, const V& k, const V& flip,
+               Tag tag, DivTag div_tag)
+{
+    using C = inv_trig_consts<V>;
+    V zero = make_float(0.0);
+    V bound1 = make_float(7.0 / 16);
+    V bound2 = make_float(11.0 / 16);
+    V pio4_hi = make_float(C::pio4_hi());
+    V pio4_lo = make_float(C::pio4_lo());
+    V atan_half_hi = make_float(C::atan_half_hi());
+    V atan_half_lo = make_float(C::atan_half_lo());
+
+    auto mid = cmp_gt(mn, mul(mx, bound1));
+    auto big = cmp_gt(mn, mul(mx, bound2));
+    V num = blend(sub(mn, mx), blend(sub(add(mn, mn), mx), mn, mid), big);
+    V den = blend(add(mn, mx), blend(add(add(mx, mx), mn), mx, mid), big);
+    V base_hi = blend(pio4_hi, blend(atan_half_hi, zero, mid), big);
+    V base_lo = blend(pio4_lo, blend(atan_half_lo, zero, mid), big);
+    V p = atan_poly(atan_div(num, den, div_tag), tag);
+
+    V hi = mul_add(k, pio4_hi, bit_xor(base_hi, flip));
+    V lo = mul_add(k, pio4_lo, bit_xor(base_lo, flip));
+    return add(hi, add(lo, bit_xor(p, flip)));
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_atan(const V& x, Tag tag)
+{
+    V zero = make_float(0.0);
+    V one = make_float(1.0);
+    V two = make_float(2.0);
+    // 1/2^64 is negligible compared to pi/2. Clamping the argument keeps the
+    // reciprocal within the normal range
+    V max_arg = make_float(18446744073709551616.0);
+    V sign_mask = make_float(-0.0);
+
+    // atan(a) = pi/2 - atan(1/a) for a > 1
+    V a = abs(x);
+    auto swap = cmp_gt(a, one);
+    V mn = min(a, one);
+    V mx = min(max(a, one), max_arg);
+    V k = blend(two, zero, swap);
+    V flip = blend(sign_mask, zero, swap);
+    V r = atan_reduced(mn, mx, k, flip, tag, tag);
+    r = copysign(r, x);
+    return blend(x, r, isnan(x));
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_atan2(const V& y, const V& x, Tag tag)
+{
+    V zero = make_float(0.0);
+    V one = make_float(1.0);
+    V two = make_float(2.0);
+    V quarter = make_float(0.25);
+    V inf = make_float(std::numeric_limits<double>::infinity());
+    V sign_mask = make_float(-0.0);
+    // mn + mx must not overflow
+    V large = make_float(std::numeric_limits<typename V::element_type>::max() / 4);
+
+    V ax = abs(x);
+    V ay = abs(y);
+    V mn = min(ax, ay);
+    V mx = max(ax, ay);
+    V scale = blend(quarter, one, cmp_gt(mx, large));
+    mn = mul(mn, scale);
+    mx = mul(mx, scale);
+
+    // both arguments zero or infinite: 0/0 is replaced with 0/1 and inf/inf
+    // with 1/1. If only the larger one is infinite, the ratio becomes 0/1
+    auto mx_inf = cmp_eq(mx, inf);
+    mn = blend(blend(one, zero, cmp_eq(mn, inf)), mn, mx_inf);
+    mx = blend(one, mx, bit_or(mx_inf, cmp_eq(mx, zero)));
+
+    // atan2(y, x) = pi/2 - atan(ax/ay) if ay > ax, and the result is
+    // subtracted from pi if x is negative, including -0. With t = 2 - k
+    // where k is the multiple of pi/4, the latter maps k to 2 + t.
+    auto swap = cmp_gt(ay, ax);
+    V t = blend(zero, two, swap);
+    V k = sub(two, copysign(t, x));
+    V flip = bit_xor(blend(sign_mask, zero, swap), sign(x));
+
+    // the reciprocal estimate does not cover the full range of mx
+    V r = atan_reduced(mn, mx, k, flip, tag, simdpp::math::ulp1());
+    r = copysign(r, y);
+    return blend(add(x, y), r, bit_or(isnan(x), isnan(y)));
+}
+
+/*  Computes the polynomial P(z) such that asin(x) = x + x*z*P(z) where
+    z = x^2 <= 1/4.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> asin_poly(const float32<N>& z, simdpp::math::ulp1)
+{
+    return horner(z, 1.666666567e-01, 7.500098646e-02, 4.459810629e-02,
+                  3.111532144e-02, 1.708165184e-02, 3.379971907e-02);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> asin_poly(const float32<N>& z, simdpp::math::ulp4)
+{
+    return horner(z, 1.666667312e-01, 7.498813421e-02, 4.500990734e-02,
+                  2.649933845e-02, 3.819635883e-02);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> asin_poly(const float64<N>& z, simdpp::math::ulp1)
+{
+    return horner(z, 1.66666666666666679097e-01, 7.49999999999833604223e-02,
+                  4.46428571465418444954e-02, 3.03819441245031924077e-02,
+                  2.23721734869321269869e-02, 1.73523802494398110861e-02,
+                  1.39713938245419084327e-02, 1.14774521431776420991e-02,
+                  1.03337878333153071190e-02, 5.41142717374761433316e-03,
+                  1.75235401814657252614e-02, -1.50393962192003107321e-02,
+                  2.88832232448364879510e-02);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> asin_poly(const float64<N>& z, simdpp::math::ulp4)
+{
+    return horner(z, 1.66666666666666473529e-01, 7.50000000002201280782e-02,
+                  4.46428571014067911871e-02, 3.03819474939896763156e-02,
+                  2.23720435422683065625e-02, 1.73553367673613543421e-02,
+                  1.39287542064709293678e-02, 1.18822424646311509218e-02,
+                  7.77041857730229200054e-03, 1.61328457018633505085e-02,
+                  -1.09135514885059289066e-02, 2.82892357368440910477e-02);
+}
+
+/*  Computes s = sqrt(z), the approximation r of asin(s)/s - 1 and z itself,
+    where z = x^2 if |x| <= 0.5 and (1 - |x|)/2 otherwise. The latter
+    follows from asin(a) = pi/2 - 2*asin(sqrt((1 - a)/2)).
+*/
+template<class V, class Tag> SIMDPP_INL
+void asin_reduce(const V& a, const V& big_mask, V& z, V& s, V& r, Tag tag)
+{
+    V half = make_float(0.5);
+    V one = make_float(1.0);
+    z = blend(mul(sub(one, a), half), mul(a, a), big_mask);
+    s = blend(sqrt(z), a, big_mask);
+    r = mul(z, asin_poly(z, tag));
+}
+
+/*  Splits s = sqrt(z) into f + c where f has the low half of the mantissa
+    cleared so that f*f is exact and c = (z - f*f)/(s + f) is the correction.
+    This way the rounding error of the square root is not doubled when
+    computing 2*asin(s).
+*/
+template<class V> SIMDPP_INL
+void sqrt_hi_lo(const V& s, const V& z, V& f, V& c)
+{
+    using C = inv_trig_consts<V>;
+    using U = typename C::uint_t;
+    U hi_mask = make_uint(C::hi_mask());
+    V zero = make_float(0.0);
+    f = bit_cast<V>(bit_and(bit_cast<U>(s), hi_mask));
+    c = div(sub(z, mul(f, f)), add(s, f));
+    // the correction is 0/0 if s is zero
+    c = bit_and(c, cmp_gt(s, zero));
+}
+
+// Computes asin(a) = pi/2 - 2*asin(s) for a > 0.5
+template<class V> SIMDPP_INL
+V asin_big(const V& s, const V& z, const V& r, simdpp::math::ulp1)
+{
+    // pi/2 - 2*(f + c + s*r), grouped so that the large terms cancel first
+    using C = inv_trig_consts<V>;
+    V two = make_float(2.0);
+    V pio2_lo = make_float(C::pio2_lo());
+    V pio4_hi = make_float(C::pio2_hi() / 2);
+    V f, c;
+    sqrt_hi_lo(s, z, f, c);
+    V p = sub(mul(two, mul(s, r)), sub(pio2_lo, mul(two, c)));
+    V q = sub(pio4_hi, mul(two, f));
+    return sub(pio4_hi, sub(p, q));
+}
+
+template<class V> SIMDPP_INL
+V asin_big(const V& s, const V&, const V& r, simdpp::math::ulp4)
+{
+    using C = inv_trig_consts<V>;
+    V two = make_float(2.0);
+    V pio2_hi = make_float(C::pio2_hi());
+    V pio2_lo = make_float(C::pio2_lo());
+    return sub(pio2_hi, sub(mul(two, mul_add(s, r, s)), pio2_lo));
+}
+
+// Computes acos(a) = 2*asin(s) for a > 0.5
+template<class V> SIMDPP_INL
+V acos_big_positive(const V& s, const V& z, const V& r, simdpp::math::ulp1)
+{
+    V two = make_float(2.0);
+    V f, c;
+    sqrt_hi_lo(s, z, f, c);
+    return mul(two, add(f, mul_add(s, r, c)));
+}
+
+template<class V> SIMDPP_INL
+V acos_big_positive(const V& s, const V&, const V& r, simdpp::math::ulp4)
+{
+    V two = make_float(2.0);
+    return mul(two, mul_add(s, r, s));
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_asin(const V& x, Tag tag)
+{
+    V half = make_float(0.5);
+    V a = abs(x);
+    V big = bit_cast<V>(cmp_gt(a, half).unmask());
+    V z, s, r;
+    asin_reduce(a, big, z, s, r, tag);
+
+    V res = blend(asin_big(s, z, r, tag), mul_add(a, r, a), big);
+    return copysign(res, x);
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_acos(const V& x, Tag tag)
+{
+    using C = inv_trig_consts<V>;
+    V zero = make_float(0.0);
+    V half = make_float(0.5);
+    V two = make_float(2.0);
+    V pio2_hi = make_float(C::pio2_hi());
+    V pio2_lo = make_float(C::pio2_lo());
+
+    V a = abs(x);
+    V big = bit_cast<V>(cmp_gt(a, half).unmask());
+    V z, s, r;
+    asin_reduce(a, big, z, s, r, tag);
+
+    // acos(x) = pi/2 - asin(x) for |x| <= 0.5, 2*asin(s) for x > 0.5 and
+    // pi - 2*asin(s) for x < -0.5
+    V res_small = sub(pio2_hi, sub(x, mul_add(neg(x), r, pio2_lo)));
+    V res_pos = acos_big_positive(s, z, r, tag);
+    V res_neg = mul(two, sub(pio2_hi, add(s, sub(mul(s, r), pio2_lo))));
+    V res_big = blend(res_neg, res_pos, cmp_lt(x, zero));
+    return blend(res_big, res_small, big);
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates the arc tangent of @a x. The result is within [-pi/2, pi/2].
+
+    The accuracy is selected by the optional @a tag argument:
+     - @c math::ulp1 (the default): the maximum error is 1 ULP.
+     - @c math::ulp4: the maximum error is 4 ULP. A shorter polynomial is
+       used and the float32 version computes the reciprocal using rcp_e()
+       and rcp_rh() instead of the division.
+     - @c math::fast: the same as @c math::ulp4.
+
+    The sign of zero is preserved and infinite arguments produce +-pi/2.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> atan(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_atan(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> atan(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_atan(x, tag);
+}
+
+/** Calculates the arc tangent of @a y/x using the signs of the arguments to
+    determine the quadrant. The result is within [-pi, pi].
+
+    The accuracy tiers are the same as in atan(), except that the division is
+    used in both tiers. The special cases follow the C standard, e.g.
+    atan2(+-0, -0) is +-pi, atan2(+-0, +0) is +-0 and atan2(+-inf, -inf) is
+    +-3*pi/4.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> atan2(const float32<N>& y, const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_atan2(y, x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> atan2(const float64<N>& y, const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_atan2(y, x, tag);
+}
+
+/** Calculates the arc sine of @a x. The result is within [-pi/2, pi/2].
+
+    The accuracy is selected by the optional @a tag argument:
+     - @c math::ulp1 (the default): the maximum error is 1 ULP.
+     - @c math::ulp4: the maximum error is 4 ULP. A shorter polynomial is
+       used and the rounding error of the square root is not compensated.
+     - @c math::fast: the same as @c math::ulp4.
+
+    Arguments whose magnitude exceeds 1 produce NaN. The sign of zero is
+    preserved.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> asin(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_asin(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> asin(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_asin(x, tag);
+}
+
+/** Calculates the arc cosine of @a x. The result is within [0, pi].
+
+    The accuracy tiers and special cases are the same as in asin().
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> acos(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_acos(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> acos(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_acos(x, tag);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
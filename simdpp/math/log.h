@@ -0,0 +1,391 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_MATH_LOG_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/log2_approx.h>
+#include <simdpp/math/detail/math_util.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+template<class V> struct log_consts;
+
+template<unsigned N> struct log_consts<float32<N>> {
+    using uint_t = uint32<N>;
+    static uint32_t sqrt_half_bits() { return 0x3f3504f3; }
+    // mask that leaves the high 12 bits of the mantissa
+    static uint32_t hi_mask() { return 0xfffff000; }
+    static float min_normal() { return std::numeric_limits<float>::min(); }
+    static float subnormal_scale() { return 8388608.0f; } // 2^23
+    static float subnormal_exp() { return 23.0f; }
+    static float ln2_hi() { return 6.9313812256e-01f; }
+    static float ln2_lo() { return 9.0580006145e-06f; }
+    static float ivln2_hi() { return 1.4428710938e+00f; }
+    static float ivln2_lo() { return -1.7605285393e-04f; }
+    static float ivln10_hi() { return 4.3432617188e-01f; }
+    static float ivln10_lo() { return -3.1689971365e-05f; }
+    static float log10_2_hi() { return 3.0102920532e-01f; }
+    static float log10_2_lo() { return 7.9034151668e-07f; }
+    // log1p(x) - x is negligible below this
+    static float log1p_max_exp() { return 25.0f; }
+};
+
+template<unsigned N> struct log_consts<float64<N>> {
+    using uint_t = uint64<N>;
+    static uint64_t sqrt_half_bits() { return 0x3fe6a09e667f3bcd; }
+    static uint64_t hi_mask() { return 0xffffffff00000000; }
+    static double min_normal() { return std::numeric_limits<double>::min(); }
+    static double subnormal_scale() { return 18014398509481984.0; } // 2^54
+    static double subnormal_exp() { return 54.0; }
+    static double ln2_hi() { return 6.93147180369123816490e-01; }
+    static double ln2_lo() { return 1.90821492927058770002e-10; }
+    static double ivln2_hi() { return 1.44269504072144627571e+00; }
+    static double ivln2_lo() { return 1.67517131648865118353e-10; }
+    static double ivln10_hi() { return 4.34294481878168880939e-01; }
+    static double ivln10_lo() { return 2.50829467116452752298e-11; }
+    static double log10_2_hi() { return 3.01029995663611771306e-01; }
+    static double log10_2_lo() { return 3.69423907715893078616e-13; }
+    static double log1p_max_exp() { return 54.0; }
+};
+
+/*  Computes the tail r of log(1+f) = f - f^2/2 + r for f within
+    [sqrt(2)/2-1, sqrt(2)-1]. hfsq must be equal to f^2/2.
+
+    For float32, r = f^3 * P(f). For float64 the polynomial would be too long,
+    thus log(1+f) is evaluated as 2*atanh(s) where s = f/(2+f), which gives
+    r = s * (hfsq + R(s^2)).
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> log1p_tail(const float32<N>& f, const float32<N>&, simdpp::math::ulp1)
+{
+    float32<N> p = horner(f, 3.333333117e-01, -2.499999399e-01, 2.000071476e-01,
+                          -1.666805765e-01, 1.424932288e-01, -1.242014112e-01,
+                          1.167699820e-01, -1.151460873e-01, 7.037683261e-02);
+    return mul(p, mul(f, mul(f, f)));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> log1p_tail(const float32<N>& f, const float32<N>&, simdpp::math::ulp4)
+{
+    float32<N> p = horner(f, 3.333333135e-01, -2.500030398e-01, 2.000120133e-01,
+                          -1.664158106e-01, 1.420994550e-01, -1.298927665e-01,
+                          1.265569776e-01, -7.974217087e-02);
+    return mul(p, mul(f, mul(f, f)));
+}
+
+// Both accuracy tiers use the same polynomial for float64, since a shorter one
+// would exceed the error bound of the ulp4 tier
+template<unsigned N, class Tag> SIMDPP_INL
+float64<N> log1p_tail(const float64<N>& f, const float64<N>& hfsq, Tag)
+{
+    float64<N> two = make_float(2.0);
+    float64<N> s = div(f, add(two, f));
+    float64<N> z = mul(s, s);
+    float64<N> r = horner(z, 6.66666666666666969958e-01, 3.99999999998991753385e-01,
+                          2.85714286261061772381e-01, 2.22222111158263022952e-01,
+                          1.81828903693254133072e-01, 1.53316840025231606217e-01,
+                          1.46168757263114538525e-01);
+    return mul(s, mul_add(r, z, hfsq));
+}
+
+/*  Splits a positive argument of a logarithm function into the exponent @a e
+    and @a f = m - 1 where m is the mantissa within [sqrt(2)/2, sqrt(2)).
+    Subnormal arguments are normalized first.
+*/
+template<class V> SIMDPP_INL
+void log_reduce(const V& a, V& e, V& f)
+{
+    using C = log_consts<V>;
+    V one = make_float(1.0);
+    V zero = make_float(0.0);
+    V min_normal = make_float(C::min_normal());
+    V subnormal_scale = make_float(C::subnormal_scale());
+    V subnormal_exp = make_float(C::subnormal_exp());
+
+    auto subnormal_mask = cmp_lt(a, min_normal);
+    V x = blend(mul(a, subnormal_scale), a, subnormal_mask);
+    V m;
+    frexp_positive(x, C::sqrt_half_bits(), e, m);
+    e = sub(e, blend(subnormal_exp, zero, subnormal_mask));
+    f = sub(m, one);
+}
+
+/*  Replaces the result of a logarithm function for arguments outside its
+    domain: NaN for arguments less than @a pole and NaN arguments, negative
+    infinity at @a pole and infinity at infinity.
+*/
+template<class V> SIMDPP_INL
+V log_special(const V& a, const V& res, const V& pole)
+{
+    V inf = make_float(std::numeric_limits<double>::infinity());
+    V neg_inf = make_float(-std::numeric_limits<double>::infinity());
+    V r = blend(inf, res, cmp_eq(a, inf));
+    r = blend(neg_inf, r, cmp_eq(a, pole));
+    // 0xff...ff is a NaN itself
+    r = bit_or(r, cmp_lt(a, pole));
+    // put back NaN if the argument was NaN
+    return blend(a, r, isnan(a));
+}
+
+// Computes log(1+f) as hi + lo where hi has its low mantissa bits cleared so
+// that its products with the *_hi constants are exact
+template<class V, class Tag> SIMDPP_INL
+void log1p_hi_lo(const V& f, V& hi, V& lo, Tag tag)
+{
+    using C = log_consts<V>;
+    using U = typename C::uint_t;
+    U hi_mask = make_uint(C::hi_mask());
+    V half = make_float(0.5);
+
+    V hfsq = mul(mul(f, f), half);
+    V r = log1p_tail(f, hfsq, tag);
+    hi = bit_cast<V>(bit_and(bit_cast<U>(sub(f, hfsq)), hi_mask));
+    lo = add(sub(sub(f, hi), hfsq), r);
+}
+
+// Computes log(1+f) as a single value
+template<class V, class Tag> SIMDPP_INL
+V log1p_reduced(const V& f, Tag tag)
+{
+    V half = make_float(0.5);
+    V hfsq = mul(mul(f, f), half);
+    return sub(f, sub(hfsq, log1p_tail(f, hfsq, tag)));
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_log(const V& a, Tag tag)
+{
+    using C = log_consts<V>;
+    V ln2_hi = make_float(C::ln2_hi());
+    V ln2_lo = make_float(C::ln2_lo());
+    V half = make_float(0.5);
+    V zero = make_float(0.0);
+
+    V e, f;
+    log_reduce(a, e, f);
+    V hfsq = mul(mul(f, f), half);
+    V r = log1p_tail(f, hfsq, tag);
+
+    // e*ln2_hi is exact and the remaining terms are summed from the smallest
+    V res = mul_add(e, ln2_lo, r);
+    res = sub(f, sub(hfsq, res));
+    res = mul_add(e, ln2_hi, res);
+    return log_special(a, res, zero);
+}
+
+template<class V> SIMDPP_INL
+V v_log2(const V& a, simdpp::math::ulp1 tag)
+{
+    using C = log_consts<V>;
+    V ivln2_hi = make_float(C::ivln2_hi());
+    V ivln2_lo = make_float(C::ivln2_lo());
+    V zero = make_float(0.0);
+
+    V e, f, hi, lo;
+    log_reduce(a, e, f);
+    log1p_hi_lo(f, hi, lo, tag);
+
+    V val_hi = mul(hi, ivln2_hi);
+    V val_lo = add(mul(add(lo, hi), ivln2_lo), mul(lo, ivln2_hi));
+    // the rounding error of e + val_hi is added to the low part
+    V w = add(e, val_hi);
+    val_lo = add(val_lo, add(sub(e, w), val_hi));
+    return log_special(a, add(val_lo, w), zero);
+}
+
+template<class V> SIMDPP_INL
+V v_log2(const V& a, simdpp::math::ulp4 tag)
+{
+    V ivln2 = make_float(1.44269504088896340736);
+    V zero = make_float(0.0);
+
+    V e, f;
+    log_reduce(a, e, f);
+    V res = mul_add(log1p_reduced(f, tag), ivln2, e);
+    return log_special(a, res, zero);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_log2(const float32<N>& a, simdpp::math::fast)
+{
+    return log2_approx(a);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_log2(const float64<N>& a, simdpp::math::fast)
+{
+    return log2_approx(a);
+}
+
+template<class V> SIMDPP_INL
+V v_log10(const V& a, simdpp::math::ulp1 tag)
+{
+    using C = log_consts<V>;
+    V ivln10_hi = make_float(C::ivln10_hi());
+    V ivln10_lo = make_float(C::ivln10_lo());
+    V log10_2_hi = make_float(C::log10_2_hi());
+    V log10_2_lo = make_float(C::log10_2_lo());
+    V zero = make_float(0.0);
+
+    V e, f, hi, lo;
+    log_reduce(a, e, f);
+    log1p_hi_lo(f, hi, lo, tag);
+
+    V val_hi = mul(hi, ivln10_hi);
+    V y = mul(e, log10_2_hi);
+    V val_lo = mul(e, log10_2_lo);
+    val_lo = add(val_lo, add(mul(add(lo, hi), ivln10_lo), mul(lo, ivln10_hi)));
+    V w = add(y, val_hi);
+    val_lo = add(val_lo, add(sub(y, w), val_hi));
+    return log_special(a, add(val_lo, w), zero);
+}
+
+template<class V> SIMDPP_INL
+V v_log10(const V& a, simdpp::math::ulp4 tag)
+{
+    V ivln10 = make_float(0.43429448190325182765);
+    V log10_2 = make_float(0.30102999566398119521);
+    V zero = make_float(0.0);
+
+    V e, f;
+    log_reduce(a, e, f);
+    V res = mul(log1p_reduced(f, tag), ivln10);
+    res = mul_add(e, log10_2, res);
+    return log_special(a, res, zero);
+}
+
+template<class V, class Tag> SIMDPP_INL
+V v_log1p(const V& a, Tag tag)
+{
+    using C = log_consts<V>;
+    V ln2_hi = make_float(C::ln2_hi());
+    V ln2_lo = make_float(C::ln2_lo());
+    V max_exp = make_float(C::log1p_max_exp());
+    V one = make_float(1.0);
+    V two = make_float(2.0);
+    V neg_one = make_float(-1.0);
+    V zero = make_float(0.0);
+    V half = make_float(0.5);
+
+    // The argument is reduced as u = 1 + a. The rounding error c of the
+    // addition is accounted for as log(u + c) = log(u) + c/u. The arguments
+    // for which u falls into the reduced range are used as is.
+    V u = add(one, a);
+    V e, m;
+    frexp_positive(u, C::sqrt_half_bits(), e, m);
+    V c = blend(sub(one, sub(u, a)), sub(a, sub(u, one)), cmp_ge(e, two));
+    c = div(c, u);
+    c = bit_andnot(c, cmp_ge(e, max_exp));
+
+    auto reduce_mask = cmp_neq(e, zero);
+    V f = blend(sub(m, one), a, reduce_mask);
+    c = bit_and(c, reduce_mask);
+
+    V hfsq = mul(mul(f, f), half);
+    V r = log1p_tail(f, hfsq, tag);
+    V res = add(mul_add(e, ln2_lo, c), r);
+    res = sub(f, sub(hfsq, res));
+    res = mul_add(e, ln2_hi, res);
+
+    // preserve the sign of zero
+    res = blend(a, res, cmp_eq(a, zero));
+    return log_special(a, res, neg_one);
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates the natural logarithm of @a x.
+
+    The accuracy is selected by the optional @a tag argument:
+     - @c math::ulp1 (the default): the maximum error is 1 ULP.
+     - @c math::ulp4: the maximum error is 4 ULP. The float32 version uses a
+       shorter polynomial.
+     - @c math::fast: the same as @c math::ulp4.
+
+    Negative arguments produce NaN, zero produces negative infinity, infinity
+    produces infinity. Subnormal arguments are supported.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> log(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> log(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log(x, tag);
+}
+
+/** Calculates the base-2 logarithm of @a x. The result is exact for powers of
+    two.
+
+    The accuracy tiers and special cases are the same as in log(). The
+    @c math::ulp4 tier additionally skips the extra-precision multiplication by
+    1/ln(2). The @c math::fast tier is log2_approx(), whose absolute error is
+    below 0.005 and which does not support subnormal arguments.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> log2(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log2(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> log2(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log2(x, tag);
+}
+
+/** Calculates the base-10 logarithm of @a x.
+
+    The accuracy tiers and special cases are the same as in log2(), except
+    that the @c math::fast tier is the same as @c math::ulp4.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> log10(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log10(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> log10(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log10(x, tag);
+}
+
+/** Calculates the natural logarithm of one plus @a x. The result is accurate
+    even if @a x is close to zero.
+
+    The accuracy tiers are the same as in log(). Arguments less than -1
+    produce NaN, -1 produces negative infinity and the sign of zero is
+    preserved.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> log1p(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log1p(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> log1p(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_log1p(x, tag);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
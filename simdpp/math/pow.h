@@ -0,0 +1,389 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_POW_H
+#define LIBSIMDPP_SIMDPP_MATH_POW_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/detail/math_util.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  Computes log2(x) = t1 + t2 for a positive finite nonzero @a x with about
+    64 bits of precision. The algorithm is the one of fdlibm's pow(): the
+    mantissa m is reduced to [sqrt(3)/2, sqrt(3)) and log(m / bp) is computed
+    as 2*atanh(s), s = (m - bp) / (m + bp) where bp is 1 or 1.5. The
+    intermediate values are split into high parts with the low 32 bits cleared,
+    so that the products of the high parts are exact.
+*/
+template<unsigned N> SIMDPP_INL
+void pow_log2_hi_lo(const float64<N>& x, float64<N>& t1, float64<N>& t2)
+{
+    float64<N> zero = make_zero();
+    float64<N> one = make_float(1.0);
+    float64<N> three = make_float(3.0);
+    float64<N> hi_mask = bit_cast<float64<N>>(uint64<N>(make_uint(0xffffffff00000000)));
+
+    // move subnormal arguments into the normal range
+    float64<N> min_normal = make_float(std::numeric_limits<double>::min());
+    float64<N> two_pow_54 = make_float(18014398509481984.0);
+    float64<N> c54 = make_float(54.0);
+    mask_float64<N> subnormal = cmp_lt(x, min_normal);
+    float64<N> ax = blend(mul(x, two_pow_54), x, subnormal);
+
+    float64<N> e, m;
+    frexp_positive(ax, 0x3febb67ae8584caa, e, m); // sqrt(3)/2
+    e = sub(e, blend(c54, zero, subnormal));
+
+    // select bp = 1.5 for the mantissas above sqrt(3/2)
+    float64<N> sqrt_3_2 = make_float(1.22474487139158904909);
+    float64<N> c1_5 = make_float(1.5);
+    float64<N> dp_h1 = make_float(5.84962487220764160156e-01); // log2(1.5) high
+    float64<N> dp_l1 = make_float(1.35003920212974897128e-08); // log2(1.5) low
+    mask_float64<N> k = cmp_gt(m, sqrt_3_2);
+    float64<N> bp = blend(c1_5, one, k);
+    float64<N> dp_h = blend(dp_h1, zero, k);
+    float64<N> dp_l = blend(dp_l1, zero, k);
+
+    // s = s_h + s_l = (m - bp) / (m + bp)
+    float64<N> u = sub(m, bp);
+    float64<N> v = div(one, add(m, bp));
+    float64<N> ss = mul(u, v);
+    float64<N> s_h = bit_and(ss, hi_mask);
+    float64<N> t_h = bit_and(add(m, bp), hi_mask);
+    float64<N> t_l = sub(m, sub(t_h, bp));
+    float64<N> s_l = mul(v, sub(sub(u, mul(s_h, t_h)), mul(s_h, t_l)));
+
+    // (3/2) * log(m / bp) = 3*s + s^3 + s^5 * P(s^2)
+    float64<N> s2 = mul(ss, ss);
+    float64<N> r = horner(s2, 5.99999999999994648725e-01, 4.28571428578550184252e-01,
+                          3.33333329818377432918e-01, 2.72728123808534006489e-01,
+                          2.30660745775561754067e-01, 2.06975017800338417784e-01);
+    r = mul(mul(s2, s2), r);
+    r = add(r, mul(s_l, add(s_h, ss)));
+    s2 = mul(s_h, s_h);
+    t_h = bit_and(add(add(three, s2), r), hi_mask);
+    t_l = sub(r, sub(sub(t_h, three), s2));
+
+    u = mul(s_h, t_h);
+    v = add(mul(s_l, t_h), mul(t_l, ss));
+    float64<N> p_h = bit_and(add(u, v), hi_mask);
+    float64<N> p_l = sub(v, sub(p_h, u));
+
+    // multiply by cp = 2/(3*ln(2)) and add the exponent
+    float64<N> cp = make_float(9.61796693925975554329e-01);
+    float64<N> cp_h = make_float(9.61796700954437255859e-01);
+    float64<N> cp_l = make_float(-7.02846165095275826516e-09);
+    float64<N> z_h = mul(cp_h, p_h);
+    float64<N> z_l = add(add(mul(cp_l, p_h), mul(p_l, cp)), dp_l);
+
+    t1 = bit_and(add(add(add(z_h, z_l), dp_h), e), hi_mask);
+    t2 = sub(z_l, sub(sub(sub(t1, e), dp_h), z_h));
+}
+
+/*  Computes 2^(p_h + p_l) where p_l is small compared to p_h. The result is
+    infinity or zero if it overflows or underflows. The boundary cases are
+    decided using the low part so that the rounding is correct.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> pow_exp2_hi_lo(const float64<N>& ph, const float64<N>& p_l)
+{
+    float64<N> zero = make_zero();
+    float64<N> one = make_float(1.0);
+    float64<N> two = make_float(2.0);
+    float64<N> inf = make_float(std::numeric_limits<double>::infinity());
+    float64<N> hi_mask = bit_cast<float64<N>>(uint64<N>(make_uint(0xffffffff00000000)));
+    float64<N> max_z = make_float(1024.0);
+    float64<N> min_z = make_float(-1075.0);
+    // -(1024 - log2(max + 0.5 ulp))
+    float64<N> ovt = make_float(8.0085662595372944372e-17);
+
+    float64<N> p_h = ph;
+    float64<N> z = add(p_l, p_h);
+    mask_float64<N> over = bit_or(cmp_gt(z, max_z),
+                                  bit_and(cmp_eq(z, max_z), cmp_gt(add(p_l, ovt), sub(z, p_h))));
+    mask_float64<N> under = bit_or(cmp_lt(z, min_z),
+                                   bit_and(cmp_eq(z, min_z), cmp_le(p_l, sub(z, p_h))));
+
+    float64<N> n = round_small(min(max(z, min_z), max_z));
+    p_h = sub(p_h, n);
+
+    // 2^r = exp(r * ln(2)) where r = p_h + p_l, |r| <= 0.5
+    float64<N> lg2 = make_float(6.93147180559945286227e-01);
+    float64<N> lg2_h = make_float(6.93147182464599609375e-01);
+    float64<N> lg2_l = make_float(-1.90465429995776804525e-09);
+    float64<N> t = bit_and(add(p_l, p_h), hi_mask);
+    float64<N> u = mul(t, lg2_h);
+    float64<N> v = add(mul(sub(p_l, sub(t, p_h)), lg2), mul(t, lg2_l));
+    float64<N> r = add(u, v);
+    float64<N> w = sub(v, sub(r, u));
+
+    t = mul(r, r);
+    float64<N> c = horner(t, 1.66666666666666019037e-01, -2.77777777770155933842e-03,
+                          6.61375632143793436117e-05, -1.65339022054652515390e-06,
+                          4.13813679705723846039e-08);
+    c = sub(r, mul(t, c));
+    float64<N> q = sub(div(mul(r, c), sub(c, two)), add(w, mul(r, w)));
+    float64<N> res = sub(one, sub(q, r));
+    res = scale_pow2(res, n);
+
+    res = blend(inf, res, over);
+    return blend(zero, res, under);
+}
+
+template<unsigned N> SIMDPP_INL
+mask_float64<N> is_integer(const float64<N>& x)
+{
+    return cmp_eq(trunc(x), x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_pow(const float64<N>& x, const float64<N>& cy)
+{
+    float64<N> zero = make_zero();
+    float64<N> one = make_float(1.0);
+    float64<N> half = make_float(0.5);
+    float64<N> inf = make_float(std::numeric_limits<double>::infinity());
+    float64<N> sign_mask = make_float(-0.0);
+    // |y * log2(x)| exceeds the exponent range for all x != 1 when |y| is
+    // above 2^64, thus clamping such arguments does not change the result
+    float64<N> max_y = make_float(18446744073709551616.0);
+
+    float64<N> ax = abs(x);
+    float64<N> y = min(max(cy, float64<N>(neg(max_y))), max_y);
+
+    float64<N> t1, t2;
+    pow_log2_hi_lo(ax, t1, t2);
+
+    // (y1 + y2) * (t1 + t2) where y1 has the low 32 bits of y cleared
+    float64<N> hi_mask = bit_cast<float64<N>>(uint64<N>(make_uint(0xffffffff00000000)));
+    float64<N> y1 = bit_and(y, hi_mask);
+    float64<N> p_l = add(mul(sub(y, y1), t1), mul(y, t2));
+    float64<N> p_h = mul(y1, t1);
+    float64<N> res = pow_exp2_hi_lo(p_h, p_l);
+
+    // zero and infinite x
+    mask_float64<N> y_neg = cmp_lt(cy, zero);
+    res = blend(blend(inf, zero, y_neg), res, cmp_eq(ax, zero));
+    res = blend(blend(zero, inf, y_neg), res, cmp_eq(ax, inf));
+
+    // negative x: the result is negative for odd integral y and NaN for
+    // nonintegral y
+    mask_float64<N> y_int = is_integer(cy);
+    mask_float64<N> y_odd = bit_andnot(y_int, is_integer(float64<N>(mul(cy, half))));
+    res = bit_or(res, bit_and(bit_and(x, sign_mask), y_odd));
+    mask_float64<N> x_neg_finite = bit_and(cmp_lt(x, zero), cmp_gt(x, float64<N>(neg(inf))));
+    res = bit_or(res, bit_andnot(x_neg_finite, y_int));
+
+    res = bit_or(res, bit_or(isnan(x), isnan(cy)));
+    // pow(x, 0) and pow(1, y) are 1 even if the other argument is NaN
+    return blend(one, res, bit_or(cmp_eq(cy, zero), cmp_eq(x, one)));
+}
+
+/*  Computes cbrt(x) following musl: the initial estimate with about 5 bits of
+    precision is computed by dividing the exponent by 3, then refined by a
+    polynomial to 23 bits which is rounded so that t*t is exact and finally
+    refined by one Newton step. The division of the high word of the bit
+    pattern by 3 is done in floating-point, since integer division is not
+    available.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_cbrt(const float64<N>& x)
+{
+    float64<N> zero = make_zero();
+    float64<N> abs_mask = bit_cast<float64<N>>(uint64<N>(make_uint(0x7fffffffffffffff)));
+    float64<N> sign_mask = make_float(-0.0);
+
+    float64<N> min_normal = make_float(std::numeric_limits<double>::min());
+    float64<N> two_pow_54 = make_float(18014398509481984.0);
+    float64<N> ax = bit_and(x, abs_mask);
+    mask_float64<N> subnormal = cmp_lt(ax, min_normal);
+    float64<N> sx = blend(mul(ax, two_pow_54), ax, subnormal);
+
+    // hx = hx / 3 + B, computed exactly in floating-point. The biases are
+    // (1023 - 1023/3 - 0.03306235651) * 2^20 and the same with the 54/3
+    // exponent adjustment of subnormals.
+    uint64<N> two_pow_52_bits = make_uint(0x4330000000000000);
+    float64<N> two_pow_52 = make_float(4503599627370496.0);
+    float64<N> b1 = make_float(715094163.0);
+    float64<N> b2 = make_float(696219795.0);
+    float64<N> third = make_float(1.0 / 3.0);
+    float64<N> three = make_float(3.0);
+    uint64<N> hx_bits = bit_or(shift_r<32>(bit_cast<uint64<N>>(sx)), two_pow_52_bits);
+    float64<N> hx = sub(bit_cast<float64<N>>(hx_bits), two_pow_52);
+    hx = round_small(sub(div(hx, three), third));
+    hx = add(hx, blend(b2, b1, subnormal));
+    uint64<N> t_bits = shift_l<32>(bit_cast<uint64<N>>(add(hx, two_pow_52)));
+    float64<N> t = bit_or(bit_cast<float64<N>>(t_bits), bit_and(x, sign_mask));
+
+    // |1/cbrt(x) - p(x)| < 2^-23.5
+    float64<N> r = mul(mul(t, t), div(t, x));
+    float64<N> p = add(horner(r, 1.87595182427177009643, -1.88497979543377169875,
+                              1.621429720105354466140),
+                       mul(mul(mul(r, r), r),
+                           horner(r, -0.758397934778766047437, 0.145996192886612446982)));
+    t = mul(t, p);
+
+    // round t away from zero to 23 bits
+    uint64<N> round_add = make_uint(0x80000000);
+    uint64<N> round_mask = make_uint(0xffffffffc0000000);
+    t = bit_cast<float64<N>>(bit_and(add(bit_cast<uint64<N>>(t), round_add), round_mask));
+
+    float64<N> s = mul(t, t);
+    r = div(x, s);
+    float64<N> w = add(t, t);
+    r = div(sub(r, t), add(w, r));
+    t = add(t, mul(t, r));
+
+    // zero, infinity and NaN are returned unchanged
+    return blend(t, x, bit_and(isfinite(x), cmp_neq(x, zero)));
+}
+
+/*  Computes hypot(x, y) as sqrt(x^2 + y^2) where the squares and their sum are
+    kept in double-word precision and the square root is corrected by one
+    Newton step. The arguments are scaled by a power of two if needed, so that
+    the intermediate values do not overflow and their errors do not underflow.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_hypot(const float64<N>& x, const float64<N>& y)
+{
+    float64<N> zero = make_zero();
+    float64<N> half = make_float(0.5);
+    float64<N> inf = make_float(std::numeric_limits<double>::infinity());
+    float64<N> big = make_float(3.2733906078961419e+150);    // 2^500
+    float64<N> small = make_float(3.5020242943059130e-136);  // 2^-450
+    float64<N> up = make_float(4.1495155688809929e+180);     // 2^600
+    float64<N> down = make_float(2.4099198651028841e-181);   // 2^-600
+    float64<N> unit = make_float(1.0);
+
+    float64<N> ax = abs(x);
+    float64<N> ay = abs(y);
+    float64<N> mx = max(ax, ay);
+    float64<N> mn = min(ax, ay);
+
+    mask_float64<N> is_big = cmp_gt(mx, big);
+    mask_float64<N> is_small = cmp_lt(mx, small);
+    float64<N> scale = blend(down, blend(up, unit, is_small), is_big);
+    float64<N> unscale = blend(up, blend(down, unit, is_small), is_big);
+    mx = mul(mx, scale);
+    mn = mul(mn, scale);
+
+    float64<N> h1, l1, h2, l2, h, l;
+    two_prod(mx, mx, h1, l1);
+    two_prod(mn, mn, h2, l2);
+    two_sum(h1, h2, h, l);
+    l = add(l, add(l1, l2));
+
+    // s + (h + l - s^2) / (2s), where h - s^2 is computed exactly
+    float64<N> s = sqrt(h);
+    float64<N> ss, sl;
+    two_prod(s, s, ss, sl);
+    float64<N> d = add(sub(sub(h, ss), sl), l);
+    float64<N> res = mul_add(div(d, s), half, s);
+    res = mul(res, unscale);
+
+    res = blend(zero, res, cmp_eq(mx, zero));
+    res = bit_or(res, bit_or(isnan(x), isnan(y)));
+    // infinity takes precedence over NaN
+    return blend(inf, res, bit_or(cmp_eq(ax, inf), cmp_eq(ay, inf)));
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates @a x raised to the power of @a y.
+
+    The computation is done in float64 precision, thus the result is
+    correctly rounded except in rare cases. The maximum error is 1 ULP over
+    the entire range. Special cases follow the C standard: pow(x, 0) and
+    pow(1, y) are 1 even if the other argument is NaN, a negative @a x with
+    an odd integral @a y produces a negative result and NaN is returned if
+    a negative finite @a x is raised to a nonintegral power. Zero and infinite
+    arguments produce zero or infinity with the sign determined the same way.
+
+    The optional accuracy tag is accepted for uniformity with the other math
+    functions. All tiers currently use the same implementation; the same
+    applies to cbrt() and hypot().
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> pow(const float32<N>& x, const float32<N>& y, Tag = Tag())
+{
+    return to_float32(detail::math::v_pow(to_float64(x), to_float64(y)));
+}
+
+/** Calculates @a x raised to the power of @a y.
+
+    The maximum error is 1 ULP over the entire range. Special cases are
+    handled the same way as in the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> pow(const float64<N>& x, const float64<N>& y, Tag = Tag())
+{
+    return detail::math::v_pow(x, y);
+}
+
+/** Calculates the cube root of @a x.
+
+    The computation is done in float64 precision, thus the maximum error is
+    1 ULP over the entire range. Zero, infinity and NaN are returned
+    unchanged.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> cbrt(const float32<N>& x, Tag = Tag())
+{
+    return to_float32(detail::math::v_cbrt(to_float64(x)));
+}
+
+/** Calculates the cube root of @a x.
+
+    The maximum error is 1 ULP over the entire range. Zero, infinity and NaN
+    are returned unchanged.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> cbrt(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_cbrt(x);
+}
+
+/** Calculates sqrt(x^2 + y^2) without intermediate overflow or underflow.
+
+    The computation is done in float64 precision, in which the squares of any
+    float32 values are representable. The maximum error is 1 ULP over the
+    entire range. Infinity is returned if either argument is infinite, even
+    if the other is NaN. Otherwise NaN is returned if either argument is NaN.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> hypot(const float32<N>& x, const float32<N>& y, Tag = Tag())
+{
+    float64<N> inf = make_float(std::numeric_limits<double>::infinity());
+    float64<N> dx = to_float64(x);
+    float64<N> dy = to_float64(y);
+    float64<N> res = sqrt(add(mul(dx, dx), mul(dy, dy)));
+    res = blend(inf, res, bit_or(cmp_eq(abs(dx), inf), cmp_eq(abs(dy), inf)));
+    return to_float32(res);
+}
+
+/** Calculates sqrt(x^2 + y^2) without intermediate overflow or underflow.
+
+    The maximum error is 1 ULP over the entire range. Special cases are
+    handled the same way as in the float32 version.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> hypot(const float64<N>& x, const float64<N>& y, Tag = Tag())
+{
+    return detail::math::v_hypot(x, y);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,153 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_RSQRT_NEWTON_H
+#define LIBSIMDPP_SIMDPP_MATH_RSQRT_NEWTON_H
+
+#include <simdpp/simd.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The initial estimate of the float64 version is computed from the bit
+    pattern of the argument: halving it halves the exponent and the magic
+    constant corrects the bias and minimizes the relative error of the
+    linear approximation of the mantissa, which is below 3.5%.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> rsqrt_estimate(const float32<N>& a)
+{
+    return rsqrt_e(a);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> rsqrt_estimate(const float64<N>& a)
+{
+    uint64<N> magic = make_uint(0x5fe6eb50c7b537a9);
+    return bit_cast<float64<N>>(sub(magic, shift_r<1>(bit_cast<uint64<N>>(a))));
+}
+
+// x_n+1 = x_n * (3 - a * x_n * x_n) / 2
+template<unsigned N> SIMDPP_INL
+float32<N> rsqrt_newton_step(const float32<N>& x, const float32<N>& a)
+{
+    return rsqrt_rh(x, a);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> rsqrt_newton_step(const float64<N>& x, const float64<N>& a)
+{
+    float64<N> half = make_float(0.5);
+    float64<N> three = make_float(3.0);
+    return mul(mul(x, half), sub(three, mul(a, mul(x, x))));
+}
+
+template<unsigned Steps, class V> SIMDPP_INL
+V v_rsqrt_newton(const V& a)
+{
+    V zero = make_zero();
+    V inf = make_float(std::numeric_limits<double>::infinity());
+
+    V x = rsqrt_estimate(a);
+    for (unsigned i = 0; i < Steps; ++i) {
+        x = rsqrt_newton_step(x, a);
+    }
+
+    x = blend(inf, x, cmp_eq(a, zero));
+    x = blend(zero, x, cmp_eq(a, inf));
+    // NaN for negative arguments
+    return bit_or(x, cmp_lt(a, zero));
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates approximate reciprocal square root of @a a by refining the
+    estimate of rsqrt_e() with @a Steps Newton-Raphson iterations. Each
+    iteration approximately doubles the number of correct bits at the cost of
+    three multiplications, one subtraction and one scaling. The iteration is
+    the same as in rsqrt_rh().
+
+    The precision of the initial estimate depends on the architecture, thus
+    the number of iterations that are needed for the full float32 precision
+    varies too: 2 iterations are enough for all supported architectures, in
+    which case the error is at most 2 ULP. On architectures where rsqrt_e()
+    is exact, such as @c NULL, iterations do not improve the result.
+
+    Infinity is returned for zero arguments and zero for infinite arguments.
+    NaN is returned for negative arguments. The results for subnormal
+    arguments are unspecified.
+
+    @code
+    r = rsqrt_newton<2>(a)
+    @endcode
+*/
+template<unsigned Steps, unsigned N> SIMDPP_INL
+float32<N> rsqrt_newton(const float32<N>& a)
+{
+    return detail::math::v_rsqrt_newton<Steps>(a);
+}
+
+/** Calculates approximate reciprocal square root of @a a by refining an
+    initial estimate with @a Steps Newton-Raphson iterations.
+
+    rsqrt_e() is not available for float64 vectors, thus the initial estimate
+    is computed from the bit pattern of the argument. Its relative error is
+    up to 3.5%, thus 4 iterations are needed for the full float64 precision,
+    in which case the error is at most 2 ULP. 3 iterations result in relative
+    error of about 3e-11.
+
+    Special cases are handled the same way as in the float32 version.
+*/
+template<unsigned Steps, unsigned N> SIMDPP_INL
+float64<N> rsqrt_newton(const float64<N>& a)
+{
+    return detail::math::v_rsqrt_newton<Steps>(a);
+}
+
+/** Calculates approximate square root of @a a as a * rsqrt_newton<Steps>(a).
+    This is faster than sqrt() on architectures where the square root
+    instruction has high latency or is not pipelined. The error is the
+    error of rsqrt_newton() plus the rounding of the final multiplication:
+    at most 4 ULP with 2 iterations for float32 and at most 3 ULP with
+    4 iterations for float64.
+
+    Zero (with the sign preserved) and infinity are returned unchanged, NaN
+    is returned for negative arguments.
+
+    @code
+    r = sqrt_newton<2>(a)
+    @endcode
+*/
+template<unsigned Steps, unsigned N> SIMDPP_INL
+float32<N> sqrt_newton(const float32<N>& a)
+{
+    float32<N> zero = make_zero();
+    float32<N> inf = make_float(std::numeric_limits<float>::infinity());
+    float32<N> r = mul(a, rsqrt_newton<Steps>(a));
+    return blend(a, r, bit_or(cmp_eq(a, zero), cmp_eq(a, inf)));
+}
+
+/** Calculates approximate square root of @a a as a * rsqrt_newton<Steps>(a).
+    Special cases are handled the same way as in the float32 version.
+*/
+template<unsigned Steps, unsigned N> SIMDPP_INL
+float64<N> sqrt_newton(const float64<N>& a)
+{
+    float64<N> zero = make_zero();
+    float64<N> inf = make_float(std::numeric_limits<double>::infinity());
+    float64<N> r = mul(a, rsqrt_newton<Steps>(a));
+    return blend(a, r, bit_or(cmp_eq(a, zero), cmp_eq(a, inf)));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
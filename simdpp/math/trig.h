@@ -0,0 +1,497 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_TRIG_H
+#define LIBSIMDPP_SIMDPP_MATH_TRIG_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include <simdpp/math/detail/math_util.h>
+#include <simdpp/math/detail/rem_pio2.h>
+#include <limits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace math {
+
+/*  The constants of the Cody-Waite reduction. pi/2 is split into parts whose
+    products with the quadrant number are exact as long as the magnitude of
+    the argument is at most max_arg().
+*/
+template<class V> struct trig_consts;
+
+template<unsigned N> struct trig_consts<float32<N>> {
+    using uint_t = uint32<N>;
+    static float max_arg() { return 8192.0f; }
+    static float shifter() { return 12582912.0f; }
+    static float two_over_pi() { return 6.36619772367581382433e-01f; }
+    static float pio2_1() { return 1.5703125f; }
+    static float pio2_2() { return 4.8375129699707031e-04f; }
+    static float pio2_3() { return 7.5495336204767227e-08f; }
+    static float pio2_4() { return 2.5633441515945189e-12f; }
+};
+
+template<unsigned N> struct trig_consts<float64<N>> {
+    using uint_t = uint64<N>;
+    static double max_arg() { return 1048576.0; }
+    static double shifter() { return 6755399441055744.0; }
+    static double two_over_pi() { return 6.36619772367581382433e-01; }
+    static double pio2_1() { return 1.57079632673412561417e+00; }
+    static double pio2_2() { return 6.07710050630396597660e-11; }
+    static double pio2_3() { return 2.02226624871116645580e-21; }
+    static double pio2_4() { return 8.47842766036889956997e-32; }
+};
+
+/*  Reduces @a x to r + r_lo = x - n*pi/2, |r| <= pi/4. The low bits of @a q
+    contain n mod 4. The magnitude of @a x must not exceed
+    trig_consts::max_arg().
+*/
+template<class V, class U> SIMDPP_INL
+void trig_reduce_small(const V& x, V& r, V& r_lo, U& q)
+{
+    using C = trig_consts<V>;
+    V shifter = make_float(C::shifter());
+    V two_over_pi = make_float(C::two_over_pi());
+    V neg_pio2_1 = make_float(-C::pio2_1());
+    V pio2_2 = make_float(C::pio2_2());
+    V pio2_3 = make_float(C::pio2_3());
+    V neg_pio2_4 = make_float(-C::pio2_4());
+
+    V t = add(mul(x, two_over_pi), shifter);
+    q = bit_cast<U>(t);
+    V n = sub(t, shifter);
+
+    // The products of n and the first three parts of pi/2 are exact and so
+    // is the first subtraction. The rounding errors of the next two
+    // subtractions are accumulated in r_lo together with the last part,
+    // which is finally renormalized so that the polynomials can treat it as
+    // a small correction.
+    V r1, r2, e1, e2;
+    t = mul_add(n, neg_pio2_1, x);
+    two_sum(t, neg(mul(n, pio2_2)), r1, e1);
+    two_sum(r1, neg(mul(n, pio2_3)), r2, e2);
+    V lo = mul_add(n, neg_pio2_4, add(e1, e2));
+    two_sum(r2, lo, r, r_lo);
+}
+
+/*  Same as trig_reduce_small, except that arguments of any magnitude are
+    supported. The elements that are too large for the Cody-Waite reduction
+    are reduced one by one using the Payne-Hanek algorithm. This path is not
+    taken at all if there are no such elements.
+*/
+template<class V, class U> SIMDPP_INL
+void trig_reduce(const V& x, V& r, V& r_lo, U& q)
+{
+    using C = trig_consts<V>;
+    using E = typename V::element_type;
+    using EU = typename U::element_type;
+    V max_arg = make_float(C::max_arg());
+
+    trig_reduce_small(x, r, r_lo, q);
+
+    auto large_mask = bit_and(cmp_gt(abs(x), max_arg), isfinite(x));
+    U large = bit_cast<U>(large_mask.unmask());
+    if (!test_bits_any(large)) {
+        return;
+    }
+
+    E xs[V::length], rs[V::length], rls[V::length];
+    EU qs[V::length], ls[V::length];
+    store_u(xs, x);
+    store_u(rs, r);
+    store_u(rls, r_lo);
+    store_u(qs, q);
+    store_u(ls, large);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (ls[i] != 0) {
+            int quadrant;
+            double lo;
+            double rd = rem_pio2_large(xs[i], lo, quadrant);
+            rs[i] = static_cast<E>(rd);
+            rls[i] = static_cast<E>((rd - rs[i]) + lo);
+            qs[i] = static_cast<EU>(quadrant);
+        }
+    }
+    r = load_u(rs);
+    r_lo = load_u(rls);
+    q = load_u(qs);
+}
+
+/*  Computes sin(r + r_lo) and cos(r + r_lo) for |r| <= pi/4 where r_lo is
+    a small correction term:
+    sin(r + r_lo) ~ r + r^3 * S(r^2) + r_lo * (1 - r^2/2)
+    cos(r + r_lo) ~ 1 - r^2/2 + r^4 * C(r^2) - r * r_lo
+    The rounding error of 1 - r^2/2 is added back to the tail of the cosine.
+*/
+template<class V> SIMDPP_INL
+void sincos_kernel(const V& r, const V& r_lo, const V& ps, const V& pc,
+                   const V& z, V& s, V& c)
+{
+    V one = make_float(1.0);
+    V half = make_float(0.5);
+    V hz = mul(z, half);
+    V s_tail = mul_add(neg(hz), r_lo, r_lo);
+    s = add(r, mul_add(mul(r, z), ps, s_tail));
+
+    V w = sub(one, hz);
+    V c_tail = sub(mul(mul(z, z), pc), mul(r, r_lo));
+    c = add(w, add(sub(sub(one, w), hz), c_tail));
+}
+
+// Computes the polynomials S and C of sincos_kernel() given z = r^2
+template<unsigned N> SIMDPP_INL
+void sincos_poly(const float32<N>& z, float32<N>& ps, float32<N>& pc)
+{
+    ps = horner(z, -1.666666418e-01, 8.332745172e-03, -1.958736102e-04);
+    pc = horner(z, 4.166666418e-02, -1.388830133e-03, 2.454760761e-05);
+}
+
+template<unsigned N> SIMDPP_INL
+void sincos_poly(const float64<N>& z, float64<N>& ps, float64<N>& pc)
+{
+    ps = horner(z, -1.66666666666666645941e-01, 8.33333333333092472008e-03,
+                -1.98412698367278080712e-04, 2.75573160886050191672e-06,
+                -2.50511292634158893343e-08, 1.59179620159847653682e-10);
+    pc = horner(z, 4.16666666666666653769e-02, -1.38888888888873876172e-03,
+                2.48015872987532281066e-05, -2.75573172660791840318e-07,
+                2.08761452222115573076e-09, -1.13825646206133424972e-11);
+}
+
+template<class V> SIMDPP_INL
+void sincos_reduced(const V& r, const V& r_lo, V& s, V& c)
+{
+    V z = mul(r, r);
+    V ps, pc;
+    sincos_poly(z, ps, pc);
+    sincos_kernel(r, r_lo, ps, pc, z, s, c);
+}
+
+/*  Same as sincos_reduced(), except that the results are computed in
+    double-word precision as s + s_lo and c + c_lo. r^2 and the products
+    with the leading terms are split into the rounded results and their
+    errors. The remaining terms contribute less than 1/9 of the sine and
+    1/40 of the cosine, thus their rounding errors are insignificant.
+*/
+template<unsigned N> SIMDPP_INL
+void sincos_reduced_hi_lo(const float64<N>& r, const float64<N>& r_lo,
+                          float64<N>& s, float64<N>& s_lo,
+                          float64<N>& c, float64<N>& c_lo)
+{
+    using V = float64<N>;
+    V one = make_float(1.0);
+    V half = make_float(0.5);
+    V z, z_err, ps, pc, rz, rz_err, t, t_err, w, w_err, s_err, c_err;
+    two_prod(r, r, z, z_err);
+    sincos_poly(z, ps, pc);
+
+    // sin(r + r_lo) ~ r + r^3 * S(r^2) + r_lo * (1 - r^2/2)
+    two_prod(r, z, rz, rz_err);
+    rz_err = mul_add(r, z_err, rz_err);
+    two_prod(rz, ps, t, t_err);
+    t_err = mul_add(rz_err, ps, t_err);
+    V hz = mul(z, half);
+    two_sum(r, t, s, s_err);
+    s_lo = add(add(s_err, t_err), mul_add(V(neg(hz)), r_lo, r_lo));
+
+    // cos(r + r_lo) ~ 1 - r^2/2 + r^4 * C(r^2) - r * r_lo
+    two_sum(one, V(neg(hz)), w, w_err);
+    V c_tail = sub(mul(mul(z, z), pc), mul_add(r, r_lo, mul(z_err, half)));
+    two_sum(w, c_tail, c, c_err);
+    c_lo = add(w_err, c_err);
+}
+
+/*  Returns the sign bit to apply to the result of sin(r) (@a quadrant_offset
+    == 0) or cos(r) (@a quadrant_offset == 1) given the quadrant @a q.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> trig_sign(const uint32<N>& q, unsigned quadrant_offset)
+{
+    uint32<N> offset = make_uint(quadrant_offset);
+    return shift_l<30>(bit_and(add(q, offset), 2));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> trig_sign(const uint64<N>& q, unsigned quadrant_offset)
+{
+    uint64<N> offset = make_uint(quadrant_offset);
+    return shift_l<62>(bit_and(add(q, offset), 2));
+}
+
+// Selects sin(x) and cos(x) out of sin(r) and cos(r)
+template<class V, class U> SIMDPP_INL
+void trig_select(const V& s, const V& c, const U& q, V& sin_x, V& cos_x)
+{
+    U one = make_uint(1);
+    auto swap_mask = bit_cast<V>(cmp_eq(bit_and(q, one), one).unmask());
+    V sr = blend(c, s, swap_mask);
+    V cr = blend(s, c, swap_mask);
+    sin_x = bit_xor(sr, bit_cast<V>(trig_sign(q, 0)));
+    cos_x = bit_xor(cr, bit_cast<V>(trig_sign(q, 1)));
+}
+
+/*  Computes r + r_lo = x - n*pi/2, sin(r + r_lo), cos(r + r_lo) and the
+    quadrant n mod 4.
+*/
+template<bool Bounded, class V, class U> SIMDPP_INL
+void trig_eval(const V& x, V& s, V& c, U& q)
+{
+    V r, r_lo;
+    if (Bounded) {
+        trig_reduce_small(x, r, r_lo, q);
+    } else {
+        trig_reduce(x, r, r_lo, q);
+    }
+    sincos_reduced(r, r_lo, s, c);
+}
+
+/*  Handles the special cases: NaN is returned for infinite arguments and the
+    sign of zero is preserved if @a odd is true. NaN arguments propagate by
+    themselves.
+*/
+template<class V> SIMDPP_INL
+V trig_special(const V& x, const V& res, bool odd)
+{
+    V zero = make_float(0.0);
+    V inf = make_float(std::numeric_limits<double>::infinity());
+    V r = bit_or(res, cmp_eq(abs(x), inf));
+    if (odd) {
+        r = blend(x, r, cmp_eq(x, zero));
+    }
+    return r;
+}
+
+template<bool Bounded, class V> SIMDPP_INL
+V v_sin(const V& x)
+{
+    using U = typename trig_consts<V>::uint_t;
+    V s, c, sin_x, cos_x;
+    U q;
+    trig_eval<Bounded>(x, s, c, q);
+    trig_select(s, c, q, sin_x, cos_x);
+    return trig_special(x, sin_x, true);
+}
+
+template<bool Bounded, class V> SIMDPP_INL
+V v_cos(const V& x)
+{
+    using U = typename trig_consts<V>::uint_t;
+    V s, c, sin_x, cos_x;
+    U q;
+    trig_eval<Bounded>(x, s, c, q);
+    trig_select(s, c, q, sin_x, cos_x);
+    return trig_special(x, cos_x, false);
+}
+
+template<bool Bounded, class V> SIMDPP_INL
+void v_sincos(const V& x, V& sin_x, V& cos_x)
+{
+    using U = typename trig_consts<V>::uint_t;
+    V s, c;
+    U q;
+    trig_eval<Bounded>(x, s, c, q);
+    trig_select(s, c, q, sin_x, cos_x);
+    sin_x = trig_special(x, sin_x, true);
+    cos_x = trig_special(x, cos_x, false);
+}
+
+template<bool Bounded, class V> SIMDPP_INL
+V v_tan(const V& x)
+{
+    using U = typename trig_consts<V>::uint_t;
+    V s, c;
+    U q;
+    trig_eval<Bounded>(x, s, c, q);
+
+    // tan(x) = sin(r)/cos(r) in even quadrants and -cos(r)/sin(r) in odd ones
+    U one = make_uint(1);
+    V odd = bit_cast<V>(cmp_eq(bit_and(q, one), one).unmask());
+    V num = blend(neg(c), s, odd);
+    V den = blend(s, c, odd);
+    return trig_special(x, div(num, den), true);
+}
+
+template<bool Bounded, class V> SIMDPP_INL
+V v_tan(const V& x, simdpp::math::ulp4)
+{
+    return v_tan<Bounded>(x);
+}
+
+/*  Same as v_tan(), except that the sine and the cosine are computed in
+    double-word precision and their quotient is rounded only once.
+*/
+template<bool Bounded, unsigned N> SIMDPP_INL
+float64<N> v_tan(const float64<N>& x, simdpp::math::ulp1)
+{
+    using V = float64<N>;
+    V r, r_lo, s, s_lo, c, c_lo;
+    uint64<N> q;
+    if (Bounded) {
+        trig_reduce_small(x, r, r_lo, q);
+    } else {
+        trig_reduce(x, r, r_lo, q);
+    }
+    sincos_reduced_hi_lo(r, r_lo, s, s_lo, c, c_lo);
+
+    uint64<N> one = make_uint(1);
+    V odd = bit_cast<V>(cmp_eq(bit_and(q, one), one).unmask());
+    V num = blend(neg(c), s, odd);
+    V num_lo = blend(neg(c_lo), s_lo, odd);
+    V den = blend(s, c, odd);
+    V den_lo = blend(s_lo, c_lo, odd);
+    return trig_special(x, div_hi_lo(num, num_lo, den, den_lo), true);
+}
+
+/*  The error of the single precision computation is up to 2 ULP, thus the
+    float32 result is computed in double precision for the ulp1 tier.
+*/
+template<bool Bounded, unsigned N> SIMDPP_INL
+float32<N> v_tan(const float32<N>& x, simdpp::math::ulp1)
+{
+    return to_float32(v_tan<Bounded>(to_float64(x)));
+}
+
+} // namespace math
+} // namespace detail
+
+/** Calculates the sine of @a x.
+
+    The argument is reduced using the Cody-Waite method. The elements whose
+    magnitude exceeds 8192 for float32 and 2^20 for float64 are reduced using
+    the Payne-Hanek method instead, which is much slower, but only affects the
+    performance if such elements are present. The maximum error is 1 ULP over
+    the entire range. NaN is returned for infinite arguments.
+
+    The optional accuracy tag is accepted for uniformity with the other math
+    functions. All tiers currently use the same implementation.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> sin(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_sin<false>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> sin(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_sin<false>(x);
+}
+
+/** Calculates the cosine of @a x.
+
+    The range reduction, accuracy and special cases are the same as in sin().
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> cos(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_cos<false>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> cos(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_cos<false>(x);
+}
+
+/** Calculates the sine and the cosine of @a x. The range reduction is shared
+    between both results, thus this is faster than calling sin() and cos()
+    separately.
+
+    The accuracy and special cases are the same as in sin().
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+void sincos(const float32<N>& x, float32<N>& sin_x, float32<N>& cos_x, Tag = Tag())
+{
+    detail::math::v_sincos<false>(x, sin_x, cos_x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+void sincos(const float64<N>& x, float64<N>& sin_x, float64<N>& cos_x, Tag = Tag())
+{
+    detail::math::v_sincos<false>(x, sin_x, cos_x);
+}
+
+/** Calculates the tangent of @a x.
+
+    The range reduction and special cases are the same as in sin(). The
+    result is computed as the ratio of the sine and the cosine. With the
+    @c math::ulp1 tag the maximum error is 1 ULP over the entire range: the
+    float32 version computes in double precision and the float64 version
+    computes the sine and the cosine in double-word precision. With the
+    @c math::ulp4 and @c math::fast tags the maximum error is 2 ULP.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> tan(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tan<false>(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> tan(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tan<false>(x, tag);
+}
+
+/** Versions of sin(), cos(), sincos() and tan() that support only arguments
+    whose magnitude does not exceed 8192 for float32 and 2^20 for float64.
+    The check for large arguments is skipped, which makes these functions
+    faster. The accuracy within the supported range is the same. The result
+    is unspecified for arguments outside the range, except that NaN is
+    returned for NaN and infinite arguments.
+*/
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> sin_bounded(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_sin<true>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> sin_bounded(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_sin<true>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> cos_bounded(const float32<N>& x, Tag = Tag())
+{
+    return detail::math::v_cos<true>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> cos_bounded(const float64<N>& x, Tag = Tag())
+{
+    return detail::math::v_cos<true>(x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+void sincos_bounded(const float32<N>& x, float32<N>& sin_x, float32<N>& cos_x, Tag = Tag())
+{
+    detail::math::v_sincos<true>(x, sin_x, cos_x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+void sincos_bounded(const float64<N>& x, float64<N>& sin_x, float64<N>& cos_x, Tag = Tag())
+{
+    detail::math::v_sincos<true>(x, sin_x, cos_x);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float32<N> tan_bounded(const float32<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tan<true>(x, tag);
+}
+
+template<unsigned N, class Tag = simdpp::math::default_accuracy> SIMDPP_INL
+float64<N> tan_bounded(const float64<N>& x, Tag tag = Tag())
+{
+    return detail::math::v_tan<true>(x, tag);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
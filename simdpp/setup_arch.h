@@ -91,6 +91,36 @@
 #else
 #define SIMDPP_USE_AVX512VL 0
 #endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_USE_AVX512VBMI 1
+#else
+#define SIMDPP_USE_AVX512VBMI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#define SIMDPP_USE_AVX512VBMI2 1
+#else
+#define SIMDPP_USE_AVX512VBMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_USE_AVX512VNNI 1
+#else
+#define SIMDPP_USE_AVX512VNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+#define SIMDPP_USE_AVX512BITALG 1
+#else
+#define SIMDPP_USE_AVX512BITALG 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_USE_AVX512VPOPCNTDQ 1
+#else
+#define SIMDPP_USE_AVX512VPOPCNTDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_USE_AVX512CD 1
+#else
+#define SIMDPP_USE_AVX512CD 0
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
 #define SIMDPP_USE_NEON 1
 #else
@@ -199,6 +229,36 @@
 #else
 #define SIMDPP_NS_ID_AVX512VL
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#define SIMDPP_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+#else
+#define SIMDPP_NS_ID_AVX512VBMI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#define SIMDPP_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+#else
+#define SIMDPP_NS_ID_AVX512VBMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#define SIMDPP_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+#else
+#define SIMDPP_NS_ID_AVX512VNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#define SIMDPP_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+#else
+#define SIMDPP_NS_ID_AVX512BITALG
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+#else
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#define SIMDPP_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+#else
+#define SIMDPP_NS_ID_AVX512CD
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_NEON
 #define SIMDPP_NS_ID_NEON SIMDPP_INSN_ID_NEON
 #else
@@ -230,7 +290,7 @@
 #define SIMDPP_NS_ID_MSA
 #endif
 
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE22(arch,                           \
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE28(arch,                           \
     SIMDPP_NS_ID_NULL,                                                          \
     SIMDPP_NS_ID_SSE2,                                                          \
     SIMDPP_NS_ID_SSE3,                                                          \
@@ -243,6 +303,12 @@
     SIMDPP_NS_ID_AVX512BW,                                                      \
     SIMDPP_NS_ID_AVX512DQ,                                                      \
     SIMDPP_NS_ID_AVX512VL,                                                      \
+    SIMDPP_NS_ID_AVX512VBMI,                                                    \
+    SIMDPP_NS_ID_AVX512VBMI2,                                                   \
+    SIMDPP_NS_ID_AVX512VNNI,                                                    \
+    SIMDPP_NS_ID_AVX512BITALG,                                                  \
+    SIMDPP_NS_ID_AVX512VPOPCNTDQ,                                               \
+    SIMDPP_NS_ID_AVX512CD,                                                      \
     SIMDPP_NS_ID_FMA3,                                                          \
     SIMDPP_NS_ID_FMA4,                                                          \
     SIMDPP_NS_ID_XOP,                                                           \
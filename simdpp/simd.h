@@ -63,14 +63,20 @@
 #include <simdpp/core/f_sqrt.h>
 #include <simdpp/core/f_sub.h>
 #include <simdpp/core/f_trunc.h>
+#include <simdpp/core/find_set.h>
 #include <simdpp/core/for_each.h>
+#include <simdpp/core/gather.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
+#include <simdpp/core/i_bit_width.h>
+#include <simdpp/core/i_bswap.h>
 #include <simdpp/core/i_clamp.h>
+#include <simdpp/core/i_div.h>
 #include <simdpp/core/i_div_p.h>
+#include <simdpp/core/i_lzcnt.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
 #include <simdpp/core/i_mul.h>
@@ -84,12 +90,15 @@
 #include <simdpp/core/i_reduce_mul.h>
 #include <simdpp/core/i_reduce_or.h>
 #include <simdpp/core/i_reduce_popcnt.h>
+#include <simdpp/core/i_rotate.h>
 #include <simdpp/core/i_shift_l.h>
 #include <simdpp/core/i_shift_r.h>
 #include <simdpp/core/i_sub.h>
 #include <simdpp/core/i_sub_sat.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
+#include <simdpp/core/load_be.h>
+#include <simdpp/core/load_expand.h>
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
@@ -104,17 +113,22 @@
 #include <simdpp/core/permute2.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/permute_var.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/core/shuffle4x2.h>
 #include <simdpp/core/shuffle_bytes16.h>
+#include <simdpp/core/shuffle_var.h>
 #include <simdpp/core/shuffle_zbytes16.h>
 #include <simdpp/core/splat.h>
 #include <simdpp/core/splat_n.h>
+#include <simdpp/core/store_compress.h>
 #include <simdpp/core/store_first.h>
 #include <simdpp/core/store.h>
+#include <simdpp/core/store_be.h>
 #include <simdpp/core/store_last.h>
 #include <simdpp/core/store_masked.h>
 #include <simdpp/core/store_packed2.h>
@@ -0,0 +1,170 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/partition.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class E>
+std::vector<E> partition_test_data(std::minstd_rand& rng, std::size_t size,
+                                   std::uint32_t range)
+{
+    std::vector<E> data(size);
+    for (auto& el : data) {
+        el = static_cast<E>(static_cast<std::int32_t>(rng() % range) -
+                            static_cast<std::int32_t>(range / 4));
+    }
+    return data;
+}
+
+template<class E>
+void test_partition_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                                  65, 100, 1001 };
+
+    for (std::size_t size : sizes) {
+        for (unsigned i = 0; i < 20; ++i) {
+            std::vector<E> data = partition_test_data<E>(rng, size, 64);
+            E pivot = static_cast<E>(static_cast<std::int32_t>(rng() % 80) - 20);
+
+            std::vector<E> expected = data;
+            std::sort(expected.begin(), expected.end());
+
+            E* mid = simdpp::partition(data.data(), data.data() + size, pivot);
+
+            std::size_t expected_mid = std::lower_bound(expected.begin(), expected.end(),
+                                                        pivot) - expected.begin();
+            TEST_EQUAL(tr, std::uint32_t(mid - data.data()), std::uint32_t(expected_mid));
+
+            std::uint32_t num_bad = 0;
+            for (std::size_t j = 0; j < size; ++j) {
+                bool in_first = data.data() + j < mid;
+                if (in_first != (data[j] < pivot)) {
+                    num_bad++;
+                }
+            }
+            TEST_EQUAL(tr, num_bad, 0u);
+
+            std::sort(data.begin(), data.end());
+            TEST_EQUAL_MEMORY(tr, data.data(), expected.data(), size);
+        }
+    }
+}
+
+template<class E>
+void test_nth_element_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 1, 2, 31, 33, 100, 1000, 20000 };
+    // few distinct values exercise the handling of duplicates
+    const std::uint32_t ranges[] = { 3, 100, 100000 };
+
+    for (std::size_t size : sizes) {
+        for (std::uint32_t range : ranges) {
+            std::vector<E> data = partition_test_data<E>(rng, size, range);
+            std::vector<E> expected = data;
+            std::sort(expected.begin(), expected.end());
+
+            std::size_t nth = rng() % size;
+            simdpp::nth_element(data.data(), data.data() + nth, data.data() + size);
+            TEST_EQUAL(tr, data[nth], expected[nth]);
+
+            std::uint32_t num_bad = 0;
+            for (std::size_t j = 0; j < size; ++j) {
+                if ((j < nth && data[nth] < data[j]) || (j > nth && data[j] < data[nth])) {
+                    num_bad++;
+                }
+            }
+            TEST_EQUAL(tr, num_bad, 0u);
+
+            std::vector<E> sorted_data = data;
+            std::sort(sorted_data.begin(), sorted_data.end());
+            TEST_EQUAL_MEMORY(tr, sorted_data.data(), expected.data(), size);
+        }
+    }
+}
+
+template<class E>
+void test_partial_sort_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 0, 1, 2, 100, 1000, 20000 };
+
+    for (std::size_t size : sizes) {
+        std::vector<E> data = partition_test_data<E>(rng, size, 100000);
+        std::size_t k = size > 0 ? rng() % size : 0;
+
+        std::vector<E> expected = data;
+        std::sort(expected.begin(), expected.end());
+        std::vector<E> top = data;
+
+        simdpp::partial_sort(data.data(), data.data() + k, data.data() + size);
+        TEST_EQUAL_MEMORY(tr, data.data(), expected.data(), k);
+
+        simdpp::top_k(top.data(), top.data() + size, k);
+        std::reverse(expected.begin(), expected.end());
+        TEST_EQUAL_MEMORY(tr, top.data(), expected.data(), k);
+    }
+}
+
+template<class E>
+void test_partition_nan(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    std::vector<E> data = partition_test_data<E>(rng, 1000, 1000);
+    data[5] = std::numeric_limits<E>::quiet_NaN();
+    data[700] = std::numeric_limits<E>::quiet_NaN();
+
+    std::vector<E> expected;
+    std::copy_if(data.begin(), data.end(), std::back_inserter(expected),
+                 [](E x) { return x == x; });
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<E> top = data;
+    simdpp::top_k(top.data(), top.data() + top.size(), 10);
+    std::vector<E> expected_top(expected.rbegin(), expected.rbegin() + 10);
+    TEST_EQUAL_MEMORY(tr, top.data(), expected_top.data(), 10);
+
+    std::size_t nth = expected.size() - 1;
+    simdpp::nth_element(data.data(), data.data() + nth, data.data() + data.size());
+    TEST_EQUAL(tr, data[nth], expected[nth]);
+}
+
+void test_algorithm_partition(TestReporter& tr)
+{
+    test_partition_impl<std::int32_t>(tr);
+    test_partition_impl<std::uint32_t>(tr);
+    test_partition_impl<float>(tr);
+    test_partition_impl<std::int64_t>(tr);
+    test_partition_impl<std::uint64_t>(tr);
+    test_partition_impl<double>(tr);
+
+    test_nth_element_impl<std::int32_t>(tr);
+    test_nth_element_impl<float>(tr);
+    test_nth_element_impl<std::int64_t>(tr);
+    test_nth_element_impl<double>(tr);
+
+    test_partial_sort_impl<std::int32_t>(tr);
+    test_partial_sort_impl<float>(tr);
+    test_partial_sort_impl<std::int64_t>(tr);
+    test_partial_sort_impl<double>(tr);
+
+    test_partition_nan<float>(tr);
+    test_partition_nan<double>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
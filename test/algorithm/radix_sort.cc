@@ -0,0 +1,131 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/radix_sort.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Maps the values to integers that have the same order. Floating-point
+// values are ordered according to IEEE-754 totalOrder.
+template<class E>
+typename std::enable_if<std::is_integral<E>::value, E>::type
+    radix_test_ordered(E x)
+{
+    return x;
+}
+
+template<class E>
+typename std::enable_if<std::is_floating_point<E>::value, std::int64_t>::type
+    radix_test_ordered(E x)
+{
+    using I = typename std::conditional<sizeof(E) == 4, std::int32_t, std::int64_t>::type;
+    I bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits < 0 ? -std::int64_t(bits & std::numeric_limits<I>::max()) - 1 : bits;
+}
+
+template<class E>
+E radix_test_value(std::minstd_rand& rng)
+{
+    switch (rng() % 8) {
+    case 0: return std::numeric_limits<E>::max();
+    case 1: return std::numeric_limits<E>::lowest();
+    case 2: return static_cast<E>(rng() % 16);
+    default: {
+        // cover all bits of 64-bit values
+        std::uint64_t bits = (std::uint64_t(rng()) << 33) ^ (std::uint64_t(rng()) << 10) ^ rng();
+        if (std::is_floating_point<E>::value) {
+            return static_cast<E>(static_cast<std::int64_t>(bits)) / 1024;
+        }
+        E r;
+        std::memcpy(&r, &bits, sizeof(r));
+        return r;
+    }
+    }
+}
+
+template<class E>
+void test_radix_sort_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 0, 1, 2, 15, 16, 17, 100, 300, 1000, 5000, 30000 };
+    const unsigned digit_bits[] = { 3, 8, 11, 16 };
+
+    for (std::size_t size : sizes) {
+        for (unsigned bits : digit_bits) {
+            for (unsigned offset = 0; offset < 2; ++offset) {
+                // offset makes the data not aligned to the cache line
+                std::vector<E> storage(size + offset);
+                E* data = storage.data() + offset;
+                for (std::size_t i = 0; i < size; ++i) {
+                    data[i] = radix_test_value<E>(rng);
+                }
+                if (std::numeric_limits<E>::has_quiet_NaN && size > 3) {
+                    data[0] = std::numeric_limits<E>::quiet_NaN();
+                    data[1] = -std::numeric_limits<E>::quiet_NaN();
+                    data[2] = -E(0);
+                    data[3] = E(0);
+                }
+
+                std::vector<decltype(radix_test_ordered(E()))> expected(size);
+                std::transform(data, data + size, expected.begin(),
+                               radix_test_ordered<E>);
+                std::sort(expected.begin(), expected.end());
+
+                simdpp::radix_sort_options options;
+                options.digit_bits = bits;
+                options.non_temporal = (bits == 11);
+                options.small_size = (bits == 16) ? 1000 : 0;
+                simdpp::radix_sort(data, data + size, options);
+
+                std::vector<decltype(radix_test_ordered(E()))> result(size);
+                std::transform(data, data + size, result.begin(),
+                               radix_test_ordered<E>);
+                TEST_EQUAL_MEMORY(tr, result.data(), expected.data(), size);
+            }
+        }
+    }
+}
+
+// Data in which most digits are the same in all elements
+void test_radix_sort_skip_passes(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    std::vector<std::uint64_t> data(10000);
+    for (auto& el : data) {
+        el = 0x1234000000000000 | (rng() % 256);
+    }
+    std::vector<std::uint64_t> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    simdpp::radix_sort_options options;
+    options.small_size = 0;
+    simdpp::radix_sort(data.data(), data.data() + data.size(), options);
+    TEST_EQUAL_MEMORY(tr, data.data(), expected.data(), data.size());
+}
+
+void test_algorithm_radix_sort(TestReporter& tr)
+{
+    test_radix_sort_impl<std::uint32_t>(tr);
+    test_radix_sort_impl<std::int32_t>(tr);
+    test_radix_sort_impl<float>(tr);
+    test_radix_sort_impl<std::uint64_t>(tr);
+    test_radix_sort_impl<std::int64_t>(tr);
+    test_radix_sort_impl<double>(tr);
+    test_radix_sort_skip_passes(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,368 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/algorithm/bitonic_sort.h>
+#include <simdpp/algorithm/bitonic_sort_kv.h>
+#include <simdpp/algorithm/sort.h>
+#include "../insn/tests.h"
+#include "../utils/test_helpers.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void test_bitonic_merge_impl(TestReporter& tr)
+{
+    using E = typename V::element_type;
+
+    std::minstd_rand rng{123};
+    std::array<E, 16> data;
+    std::array<E, 16> expected_data;
+
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        for (auto& el : data) {
+            el = static_cast<E>(rng() % 64);
+        }
+        std::sort(data.begin(), data.begin() + 8);
+        std::sort(data.begin() + 8, data.end());
+        expected_data = data;
+        std::sort(expected_data.begin(), expected_data.end());
+
+        V merged1 = simdpp::load_u(&data[0]);
+        V merged2 = simdpp::load_u(&data[8]);
+        simdpp::bitonic_merge_asc(merged1, merged2);
+
+        V expected1 = simdpp::load_u(&expected_data[0]);
+        V expected2 = simdpp::load_u(&expected_data[8]);
+        TEST_EQUAL(tr, merged1, expected1);
+        TEST_EQUAL(tr, merged2, expected2);
+    }
+}
+
+// Returns a value whose high and low 32-bit halves both affect the ordering
+template<class E>
+E gen_sort64_value(std::minstd_rand& rng)
+{
+    std::int64_t hi = static_cast<std::int64_t>(rng() % 8) - 4;
+    std::int64_t lo = static_cast<std::int64_t>(rng() % 4) * 0x60000000;
+    return static_cast<E>(hi * 0x100000000 + lo);
+}
+
+template<class V>
+void test_bitonic_sort64_impl(TestReporter& tr)
+{
+    using E = typename V::element_type;
+
+    std::minstd_rand rng{123};
+    std::array<E, V::length> data;
+    std::array<E, V::length> sorted_data;
+
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        for (auto& el : data) {
+            el = gen_sort64_value<E>(rng);
+        }
+        std::array<E, V::length> expected_data = data;
+
+        V v = simdpp::load_u(data.data());
+        simdpp::bitonic_sort_asc(v);
+        simdpp::store_u(sorted_data.data(), v);
+        std::sort(expected_data.begin(), expected_data.end());
+        TEST_EQUAL_MEMORY(tr, sorted_data.data(), expected_data.data(), V::length);
+
+        v = simdpp::load_u(data.data());
+        simdpp::bitonic_sort_dec(v);
+        simdpp::store_u(sorted_data.data(), v);
+        std::sort(expected_data.begin(), expected_data.end(), std::greater<E>());
+        TEST_EQUAL_MEMORY(tr, sorted_data.data(), expected_data.data(), V::length);
+    }
+}
+
+template<class V>
+void test_bitonic_sort64_x2_impl(TestReporter& tr)
+{
+    using E = typename V::element_type;
+
+    std::minstd_rand rng{123};
+    std::array<E, 16> data;
+    std::array<E, 16> sorted_data;
+
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        for (auto& el : data) {
+            el = gen_sort64_value<E>(rng);
+        }
+        std::array<E, 16> expected_data = data;
+
+        V v0 = simdpp::load_u(&data[0]);
+        V v1 = simdpp::load_u(&data[8]);
+        if (i % 2 == 0) {
+            simdpp::bitonic_sort_asc(v0, v1);
+            std::sort(expected_data.begin(), expected_data.end());
+        } else {
+            simdpp::bitonic_sort_dec(v0, v1);
+            std::sort(expected_data.begin(), expected_data.end(), std::greater<E>());
+        }
+        simdpp::store_u(&sorted_data[0], v0);
+        simdpp::store_u(&sorted_data[8], v1);
+        TEST_EQUAL_MEMORY(tr, sorted_data.data(), expected_data.data(), 16);
+    }
+}
+
+template<class V>
+void test_bitonic_sort_kv_impl(TestReporter& tr)
+{
+    using E = typename V::element_type;
+    using U = simdpp::uint32<8>;
+
+    std::minstd_rand rng{123};
+    std::array<E, 16> keys;
+    std::array<std::uint32_t, 16> values;
+    std::array<E, 16> sorted_keys;
+    std::array<std::uint32_t, 16> sorted_values;
+
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        // use few distinct keys so that there are many duplicates
+        for (std::uint32_t j = 0; j < 16; ++j) {
+            keys[j] = static_cast<E>(rng() % 8);
+            values[j] = j;
+        }
+
+        V k0 = simdpp::load_u(&keys[0]);
+        V k1 = simdpp::load_u(&keys[8]);
+        U v0 = simdpp::load_u(&values[0]);
+        U v1 = simdpp::load_u(&values[8]);
+        if (i % 2 == 0) {
+            simdpp::bitonic_sort_kv_asc(k0, k1, v0, v1);
+        } else {
+            simdpp::bitonic_sort_kv_dec(k0, k1, v0, v1);
+        }
+        simdpp::store_u(&sorted_keys[0], k0);
+        simdpp::store_u(&sorted_keys[8], k1);
+        simdpp::store_u(&sorted_values[0], v0);
+        simdpp::store_u(&sorted_values[8], v1);
+
+        std::array<E, 16> expected_keys = keys;
+        if (i % 2 == 0) {
+            std::sort(expected_keys.begin(), expected_keys.end());
+        } else {
+            std::sort(expected_keys.begin(), expected_keys.end(), std::greater<E>());
+        }
+        TEST_EQUAL_MEMORY(tr, sorted_keys.data(), expected_keys.data(), 16);
+
+        // each value must still refer to its key and must be present once
+        std::array<E, 16> keys_by_values;
+        for (std::uint32_t j = 0; j < 16; ++j) {
+            keys_by_values[j] = keys[sorted_values[j] % 16];
+        }
+        TEST_EQUAL_MEMORY(tr, keys_by_values.data(), sorted_keys.data(), 16);
+
+        std::sort(sorted_values.begin(), sorted_values.end());
+        TEST_EQUAL_MEMORY(tr, sorted_values.data(), values.data(), 16);
+    }
+}
+
+template<class E>
+void test_sort_by_key_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 0, 1, 2, 7, 16, 17, 100, 1000, 2049, 20000 };
+
+    for (std::size_t size : sizes) {
+        std::vector<E> keys(size);
+        std::vector<std::uint32_t> values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            keys[i] = static_cast<E>(static_cast<std::int32_t>(rng() % 512) - 128);
+            values[i] = static_cast<std::uint32_t>(i);
+        }
+        // the maximum value must not be confused with the padding
+        if (size > 3) {
+            keys[3] = std::numeric_limits<E>::has_infinity
+                    ? std::numeric_limits<E>::infinity()
+                    : std::numeric_limits<E>::max();
+        }
+        std::vector<E> orig_keys = keys;
+        std::vector<E> expected_keys = keys;
+        std::sort(expected_keys.begin(), expected_keys.end());
+
+        std::vector<std::uint32_t> indices(size);
+        simdpp::argsort(keys.data(), keys.data() + size, indices.data());
+        simdpp::sort_by_key(keys.data(), keys.data() + size, values.data());
+
+        TEST_EQUAL_MEMORY(tr, keys.data(), expected_keys.data(), size);
+        TEST_EQUAL_MEMORY(tr, values.data(), indices.data(), size);
+
+        std::vector<E> keys_by_values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            keys_by_values[i] = orig_keys[values[i] % size];
+        }
+        TEST_EQUAL_MEMORY(tr, keys_by_values.data(), keys.data(), size);
+
+        std::vector<std::uint32_t> expected_values(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            expected_values[i] = static_cast<std::uint32_t>(i);
+        }
+        std::sort(values.begin(), values.end());
+        TEST_EQUAL_MEMORY(tr, values.data(), expected_values.data(), size);
+    }
+}
+
+template<class E>
+void test_sort_float_nan(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    std::vector<E> data(1000);
+    for (auto& el : data) {
+        el = static_cast<E>(rng() % 100);
+    }
+    data[10] = std::numeric_limits<E>::quiet_NaN();
+    data[500] = std::numeric_limits<E>::infinity();
+    data[999] = -std::numeric_limits<E>::quiet_NaN();
+
+    std::vector<E> expected_data = data;
+    auto expected_last = std::partition(expected_data.begin(), expected_data.end(),
+                                        [](E x) { return x == x; });
+    std::sort(expected_data.begin(), expected_last);
+
+    simdpp::sort(data.data(), data.data() + data.size());
+
+    std::size_t num_sorted = expected_last - expected_data.begin();
+    TEST_EQUAL_MEMORY(tr, data.data(), expected_data.data(), num_sorted);
+    std::uint32_t num_nan = std::count_if(data.begin() + num_sorted, data.end(),
+                                          [](E x) { return std::isnan(x); });
+    TEST_EQUAL(tr, num_nan, 2u);
+}
+
+template<class E, class I>
+void test_sort_total_order_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = { 0, 1, 2, 7, 16, 17, 100, 1000, 2049, 20000 };
+
+    const E special[] = {
+        E(0), -E(0), std::numeric_limits<E>::infinity(),
+        -std::numeric_limits<E>::infinity(), std::numeric_limits<E>::quiet_NaN(),
+        -std::numeric_limits<E>::quiet_NaN(), std::numeric_limits<E>::denorm_min(),
+        -std::numeric_limits<E>::denorm_min(), std::numeric_limits<E>::max(),
+        std::numeric_limits<E>::lowest()
+    };
+    const std::size_t num_special = sizeof(special) / sizeof(special[0]);
+
+    // maps the values to integers ordered according to IEEE-754 totalOrder
+    auto to_ordered = [](E x)
+    {
+        I bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return bits < 0 ? -(bits & std::numeric_limits<I>::max()) - 1 : bits;
+    };
+
+    for (std::size_t size : sizes) {
+        std::vector<E> data(size);
+        for (auto& el : data) {
+            if (rng() % 4 == 0) {
+                el = special[rng() % num_special];
+            } else {
+                el = static_cast<E>(static_cast<std::int32_t>(rng() % 4096) - 2048) / 16;
+            }
+        }
+        if (size > 1) {
+            // a NaN with a payload
+            I bits;
+            std::memcpy(&bits, &special[4], sizeof(bits));
+            bits += 1;
+            std::memcpy(&data[size - 1], &bits, sizeof(bits));
+        }
+
+        std::vector<I> expected(size);
+        std::transform(data.begin(), data.end(), expected.begin(), to_ordered);
+        std::sort(expected.begin(), expected.end());
+
+        simdpp::sort_total_order(data.data(), data.data() + size);
+
+        std::vector<I> result(size);
+        std::transform(data.begin(), data.end(), result.begin(), to_ordered);
+        TEST_EQUAL_MEMORY(tr, result.data(), expected.data(), size);
+    }
+}
+
+template<class E>
+void test_sort_impl(TestReporter& tr)
+{
+    std::minstd_rand rng{123};
+    const std::size_t sizes[] = {
+        0, 1, 2, 7, 8, 15, 16, 17, 31, 33, 100, 255, 256, 1000, 2048, 2049,
+        5000, 20000
+    };
+
+    for (std::size_t size : sizes) {
+        std::vector<E> data(size);
+        for (auto& el : data) {
+            // include negative numbers and duplicates
+            el = static_cast<E>(static_cast<std::int32_t>(rng() % 4096) - 1024);
+        }
+        std::vector<E> expected_data = data;
+        std::sort(expected_data.begin(), expected_data.end());
+
+        simdpp::sort(data.data(), data.data() + data.size());
+
+        TEST_EQUAL_MEMORY(tr, data.data(), expected_data.data(), size);
+    }
+}
+
+void test_algorithm_sort(TestReporter& tr)
+{
+    test_bitonic_merge_impl<simdpp::float32<8>>(tr);
+    test_bitonic_merge_impl<simdpp::uint32<8>>(tr);
+    test_bitonic_merge_impl<simdpp::int32<8>>(tr);
+
+    test_bitonic_sort_kv_impl<simdpp::float32<8>>(tr);
+    test_bitonic_sort_kv_impl<simdpp::uint32<8>>(tr);
+    test_bitonic_sort_kv_impl<simdpp::int32<8>>(tr);
+
+    test_sort_impl<float>(tr);
+    test_sort_impl<std::uint32_t>(tr);
+    test_sort_impl<std::int32_t>(tr);
+    test_sort_float_nan<float>(tr);
+
+    test_bitonic_sort64_impl<simdpp::int64<2>>(tr);
+    test_bitonic_sort64_impl<simdpp::int64<4>>(tr);
+    test_bitonic_sort64_impl<simdpp::int64<8>>(tr);
+    test_bitonic_sort64_impl<simdpp::uint64<2>>(tr);
+    test_bitonic_sort64_impl<simdpp::uint64<4>>(tr);
+    test_bitonic_sort64_impl<simdpp::uint64<8>>(tr);
+    test_bitonic_sort64_impl<simdpp::float64<2>>(tr);
+    test_bitonic_sort64_impl<simdpp::float64<4>>(tr);
+    test_bitonic_sort64_impl<simdpp::float64<8>>(tr);
+
+    test_bitonic_sort64_x2_impl<simdpp::int64<8>>(tr);
+    test_bitonic_sort64_x2_impl<simdpp::uint64<8>>(tr);
+    test_bitonic_sort64_x2_impl<simdpp::float64<8>>(tr);
+
+    test_bitonic_merge_impl<simdpp::int64<8>>(tr);
+    test_bitonic_merge_impl<simdpp::uint64<8>>(tr);
+    test_bitonic_merge_impl<simdpp::float64<8>>(tr);
+
+    test_sort_impl<std::int64_t>(tr);
+    test_sort_impl<std::uint64_t>(tr);
+    test_sort_impl<double>(tr);
+    test_sort_float_nan<double>(tr);
+
+    test_sort_total_order_impl<float, std::int32_t>(tr);
+    test_sort_total_order_impl<double, std::int64_t>(tr);
+
+    test_sort_by_key_impl<float>(tr);
+    test_sort_by_key_impl<std::uint32_t>(tr);
+    test_sort_by_key_impl<std::int32_t>(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -158,6 +158,88 @@ void test_popcnt_type(TestResultsSet& tc)
     TEST_PUSH_ARRAY_OP1_T(tc, unsigned, V, reduce_popcnt, s);
 }
 
+template<class V, class V32I>
+void test_bit_width_type(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    TestData<V32I> s;
+    s.add(make_uint(0x00000000, 0x00000001, 0x00000002, 0x00000003));
+    s.add(make_uint(0x000000ff, 0x00000100, 0x00ffffff, 0x01000000));
+    s.add(make_uint(0x01ffffff, 0x7fffffff, 0x80000000, 0xffffffff));
+    s.add(make_uint(0x00000000, 0x80000001, 0x00000000, 0x00000001));
+    s.add(make_uint(0xffffffff, 0x00000000, 0x00000000, 0xffffffff));
+    s.add(make_uint(0x12345678, 0x00000000, 0x00f00000, 0x00000000));
+
+    TEST_PUSH_ARRAY_OP1(tc, V, bit_width, s);
+    TEST_PUSH_ARRAY_OP1(tc, V, ilog2, s);
+}
+
+template<class V, class V32I>
+void test_bswap_type(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    TestData<V32I> s;
+    s.add(make_uint(0x01020304, 0x05060708, 0x090a0b0c, 0x0d0e0f10));
+    s.add(make_uint(0xff000000, 0x00000000, 0x000000ff, 0x00ff0000));
+    s.add(make_uint(0x12345678, 0x9abcdef0, 0x80000001, 0x7ffffffe));
+    s.add(make_uint(0xffffffff, 0x00000000, 0xffff0000, 0x0000ffff));
+
+    TEST_PUSH_ARRAY_OP1(tc, V, bswap, s);
+}
+
+template<class V, class V32I>
+void test_lzcnt_type(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    TestData<V32I> s;
+    s.add(make_uint(0x00000000, 0x00000001, 0x00000002, 0x00000003));
+    s.add(make_uint(0x000000ff, 0x00000100, 0x00ffffff, 0x01000000));
+    s.add(make_uint(0x01ffffff, 0x7fffffff, 0x80000000, 0xffffffff));
+    s.add(make_uint(0x00000000, 0x80000001, 0x00000000, 0x00000001));
+    s.add(make_uint(0x12345678, 0x9abcdef0, 0x00f00000, 0x00080000));
+    s.add(make_uint(0x10204080, 0x01020408, 0x00100000, 0x00000000));
+
+    TEST_PUSH_ARRAY_OP1(tc, V, lzcnt, s);
+    TEST_PUSH_ARRAY_OP1(tc, V, tzcnt, s);
+}
+
+template<class V, class V32I>
+void test_find_set_type(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    // each 64-bit half is either all ones or all zeros
+    TestData<V32I> s;
+    s.add(make_uint(0x00000000, 0x00000000, 0x00000000, 0x00000000));
+    s.add(make_uint(0xffffffff, 0xffffffff, 0x00000000, 0x00000000));
+    s.add(make_uint(0x00000000, 0x00000000, 0xffffffff, 0xffffffff));
+    s.add(make_uint(0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff));
+
+    TEST_PUSH_ARRAY_OP1_T(tc, int, V, find_first_set, s);
+    TEST_PUSH_ARRAY_OP1_T(tc, int, V, find_last_set, s);
+
+    // a single set element at various positions
+    E data[V::length];
+    for (unsigned k = 0; k < V::length; k += V::length / 4 + 1) {
+        for (unsigned i = 0; i < V::length; i++) {
+            data[i] = i == k ? E(~E(0)) : E(0);
+        }
+        V a = load_u(data);
+        TEST_EQUAL(tr, find_first_set(a), int(k));
+        TEST_EQUAL(tr, find_last_set(a), int(k));
+
+        V m = (V) cmp_neq(a, (V) make_zero());
+        TEST_EQUAL(tr, find_first_set(m), int(k));
+    }
+    data[V::length - 1] = ~E(0);
+    V a = load_u(data);
+    TEST_EQUAL(tr, find_last_set(a), int(V::length - 1));
+}
+
 template<unsigned B>
 void test_bitwise_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -182,6 +264,23 @@ void test_bitwise_n(TestResultsSet& tc, TestReporter& tr)
     test_popcnt_type<uint32_n, uint32_n>(tc);
     test_popcnt_type<uint64_n, uint32_n>(tc);
 
+    test_bit_width_type<uint32_n, uint32_n>(tc);
+    test_bit_width_type<uint64_n, uint32_n>(tc);
+
+    test_bswap_type<uint16_n, uint32_n>(tc);
+    test_bswap_type<uint32_n, uint32_n>(tc);
+    test_bswap_type<uint64_n, uint32_n>(tc);
+
+    test_lzcnt_type<uint8_n, uint32_n>(tc);
+    test_lzcnt_type<uint16_n, uint32_n>(tc);
+    test_lzcnt_type<uint32_n, uint32_n>(tc);
+    test_lzcnt_type<uint64_n, uint32_n>(tc);
+
+    test_find_set_type<uint8_n, uint32_n>(tc, tr);
+    test_find_set_type<uint16_n, uint32_n>(tc, tr);
+    test_find_set_type<uint32_n, uint32_n>(tc, tr);
+    test_find_set_type<uint64_n, uint32_n>(tc, tr);
+
     // masks
     Vectors<B,4> v;
     Masks<B,4> m;
@@ -247,6 +346,15 @@ void test_bitwise_n(TestResultsSet& tc, TestReporter& tr)
         TEST_PUSH(tc, uint64_n, bit_not(m.u64[i]));
         TEST_PUSH(tc, float32_n, bit_not(m.f32[i]));
         TEST_PUSH(tc, float64_n, bit_not(m.f64[i]));
+
+        TEST_PUSH(tc, int, find_first_set(m.u8[i]));
+        TEST_PUSH(tc, int, find_first_set(m.u16[i]));
+        TEST_PUSH(tc, int, find_first_set(m.u32[i]));
+        TEST_PUSH(tc, int, find_first_set(m.u64[i]));
+        TEST_PUSH(tc, int, find_last_set(m.u8[i]));
+        TEST_PUSH(tc, int, find_last_set(m.u16[i]));
+        TEST_PUSH(tc, int, find_last_set(m.u32[i]));
+        TEST_PUSH(tc, int, find_last_set(m.u64[i]));
     }
 }
 
@@ -32,7 +32,7 @@ void test_compare_n(TestResultsSet& tc)
     using int16_n = int16<B/2>;
     using uint32_n = uint32<B/4>;
     using int32_n = int32<B/4>;
-#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     using uint64_n = uint64<B/8>;
     using int64_n = int64<B/8>;
 #endif
@@ -87,7 +87,7 @@ void test_compare_n(TestResultsSet& tc)
         TEST_COMPARE_TESTER_HELPER(tc, uint32_n, sl, sr);
     }
 
-#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64
     //int64_n
     {
         TestData<uint64_n> sl;
@@ -11,6 +11,18 @@
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
+template<class V, class S>
+void test_div_by(TestResultsSet& tc, const S& s, typename V::element_type divisor)
+{
+    using namespace simdpp;
+
+    divider<typename V::element_type> d(divisor);
+    auto div_d = [&](const V& a) { return V(div(a, d)); };
+    auto mod_d = [&](const V& a) { return V(mod(a, d)); };
+    TEST_PUSH_ARRAY_OP1(tc, V, div_d, s);
+    TEST_PUSH_ARRAY_OP1(tc, V, mod_d, s);
+}
+
 template<unsigned B>
 void test_math_int8_n(TestResultsSet& tc)
 {
@@ -55,6 +67,13 @@ void test_math_int8_n(TestResultsSet& tc)
     TEST_PUSH_ARRAY_OP1(tc, int8_n, neg, s);
     TEST_PUSH_ARRAY_OP1(tc, int8_n, abs, s);
 
+    test_div_by<uint8_n>(tc, s, 7);
+    test_div_by<uint8_n>(tc, s, 128);
+    test_div_by<uint8_n>(tc, s, 255);
+    test_div_by<int8_n>(tc, s, 3);
+    test_div_by<int8_n>(tc, s, -10);
+    test_div_by<int8_n>(tc, s, -128);
+
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint16_t, uint8_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int16_t, int8_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint8_t, uint8_n, reduce_or, s);
@@ -118,6 +137,13 @@ void test_math_int16_n(TestResultsSet& tc)
     TEST_PUSH_ARRAY_OP1(tc, int16_n, neg, s);
     TEST_PUSH_ARRAY_OP1(tc, int16_n, abs, s);
 
+    test_div_by<uint16_n>(tc, s, 7);
+    test_div_by<uint16_n>(tc, s, 1000);
+    test_div_by<uint16_n>(tc, s, 0xffff);
+    test_div_by<int16_n>(tc, s, 1);
+    test_div_by<int16_n>(tc, s, -3);
+    test_div_by<int16_n>(tc, s, 641);
+
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint16_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int16_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint16_n, reduce_mul, s);
@@ -159,6 +185,7 @@ void test_math_int32_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, avg, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int32_n, avg_trunc, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int32_n, mul_hi, s);
 
 #if SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
     TEST_PUSH_ALL_COMB_OP2_T(tc, int64<B/4>, int32_n, mull, s);
@@ -174,10 +201,18 @@ void test_math_int32_n(TestResultsSet& tc)
 
     TEST_PUSH_ALL_COMB_OP2_T(tc, uint64<B/4>, uint32_n, mull, s);
     TEST_PUSH_ALL_COMB_OP2_T(tc, uint32_n, uint32_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, mul_hi, s);
 
     TEST_PUSH_ARRAY_OP1(tc, int32_n, neg, s);
     TEST_PUSH_ARRAY_OP1(tc, int32_n, abs, s);
 
+    test_div_by<uint32_n>(tc, s, 7);
+    test_div_by<uint32_n>(tc, s, 1000000007);
+    test_div_by<uint32_n>(tc, s, 0x80000000);
+    test_div_by<int32_n>(tc, s, -1);
+    test_div_by<int32_n>(tc, s, 10);
+    test_div_by<int32_n>(tc, s, -65537);
+
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint32_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int32_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint32_n, reduce_mul, s);
@@ -224,7 +259,12 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, sub, s);
 
-#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
+    TEST_PUSH_ALL_COMB_OP2_T(tc, int64_n, int64_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_hi, s);
+    TEST_PUSH_ALL_COMB_OP2_T(tc, uint64_n, uint64_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_hi, s);
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, min, s);
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, max, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, min, s);
@@ -236,6 +276,13 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ARRAY_OP1(tc, int64_n, neg, s);
     TEST_PUSH_ARRAY_OP1(tc, int64_n, abs, s);
 
+    test_div_by<uint64_n>(tc, s, 7);
+    test_div_by<uint64_n>(tc, s, 0x123456789);
+    test_div_by<uint64_n>(tc, s, 0xffffffffffffffff);
+    test_div_by<int64_n>(tc, s, 3);
+    test_div_by<int64_n>(tc, s, -1000000000000);
+    test_div_by<int64_n>(tc, s, INT64_MIN);
+
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint64_t, uint64_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int64_t, int64_n, reduce_add, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint64_t, uint64_n, reduce_or, s);
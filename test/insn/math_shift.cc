@@ -36,6 +36,30 @@ struct Test_shift_r {
     }
 };
 
+template<class V, unsigned i>
+struct Test_rotate {
+    static const unsigned limit = V::num_bits - 1;
+    static void test(TestResultsSet& tc, const V& a)
+    {
+        V b = simdpp::rotate_l<i>(a);
+        V c = simdpp::rotate_r<i>(a);
+        TEST_PUSH(tc, V, b);
+        TEST_PUSH(tc, V, c);
+    }
+};
+
+template<class V, unsigned i>
+struct Test_shift2 {
+    static const unsigned limit = V::num_bits - 1;
+    static void test(TestResultsSet& tc, const V& a, const V& b)
+    {
+        V c = simdpp::shift_l2<i>(a, b);
+        V d = simdpp::shift_r2<i>(a, b);
+        TEST_PUSH(tc, V, c);
+        TEST_PUSH(tc, V, d);
+    }
+};
+
 template<unsigned B>
 void test_math_shift_int8_n(TestResultsSet& tc)
 {
@@ -51,6 +75,10 @@ void test_math_shift_int8_n(TestResultsSet& tc)
     TemplateTestArrayHelper<Test_shift_l, IV>::run(tc, v.i8, vnum);
     TemplateTestArrayHelper<Test_shift_r, UV>::run(tc, v.u8, vnum);
     TemplateTestArrayHelper<Test_shift_r, IV>::run(tc, v.i8, vnum);
+    TemplateTestArrayHelper<Test_rotate, UV>::run(tc, v.u8, vnum);
+    TemplateTestArrayHelper<Test_rotate, IV>::run(tc, v.i8, vnum);
+    TemplateTestArrayHelper<Test_shift2, UV>::run(tc, v.u8, v.u8 + 1, vnum - 1);
+    TemplateTestArrayHelper<Test_shift2, IV>::run(tc, v.i8, v.i8 + 1, vnum - 1);
 
     TestData<UV> shift;
     for (unsigned i = 0; i < 8; ++i) {
@@ -78,6 +106,14 @@ void test_math_shift_int8_n(TestResultsSet& tc)
 #if SIMDPP_HAS_INT8_SHIFT_R_BY_VECTOR
     TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, shift_r, data, shift);
 #endif
+#if SIMDPP_HAS_UINT8_ROTATE_BY_VECTOR
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_r, data, shift);
+#endif
+#if SIMDPP_HAS_INT8_ROTATE_BY_VECTOR
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_r, data, shift);
+#endif
 }
 
 template<unsigned B>
@@ -95,6 +131,10 @@ void test_math_shift_int16_n(TestResultsSet& tc)
     TemplateTestArrayHelper<Test_shift_l, IV>::run(tc, v.i16, vnum);
     TemplateTestArrayHelper<Test_shift_r, UV>::run(tc, v.u16, vnum);
     TemplateTestArrayHelper<Test_shift_r, IV>::run(tc, v.i16, vnum);
+    TemplateTestArrayHelper<Test_rotate, UV>::run(tc, v.u16, vnum);
+    TemplateTestArrayHelper<Test_rotate, IV>::run(tc, v.i16, vnum);
+    TemplateTestArrayHelper<Test_shift2, UV>::run(tc, v.u16, v.u16 + 1, vnum - 1);
+    TemplateTestArrayHelper<Test_shift2, IV>::run(tc, v.i16, v.i16 + 1, vnum - 1);
 
 
     TestData<UV> shift;
@@ -127,6 +167,14 @@ void test_math_shift_int16_n(TestResultsSet& tc)
 #if SIMDPP_HAS_INT16_SHIFT_R_BY_VECTOR
     TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, shift_r, data, shift);
 #endif
+#if SIMDPP_HAS_UINT16_ROTATE_BY_VECTOR
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_r, data, shift);
+#endif
+#if SIMDPP_HAS_INT16_ROTATE_BY_VECTOR
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_r, data, shift);
+#endif
 }
 
 template<unsigned B>
@@ -144,6 +192,10 @@ void test_math_shift_int32_n(TestResultsSet& tc)
     TemplateTestArrayHelper<Test_shift_l, IV>::run(tc, v.i32, vnum);
     TemplateTestArrayHelper<Test_shift_r, UV>::run(tc, v.u32, vnum);
     TemplateTestArrayHelper<Test_shift_r, IV>::run(tc, v.i32, vnum);
+    TemplateTestArrayHelper<Test_rotate, UV>::run(tc, v.u32, vnum);
+    TemplateTestArrayHelper<Test_rotate, IV>::run(tc, v.i32, vnum);
+    TemplateTestArrayHelper<Test_shift2, UV>::run(tc, v.u32, v.u32 + 1, vnum - 1);
+    TemplateTestArrayHelper<Test_shift2, IV>::run(tc, v.i32, v.i32 + 1, vnum - 1);
 
     TestData<UV> shift;
     for (unsigned i = 0; i < 32; ++i) {
@@ -176,6 +228,10 @@ void test_math_shift_int32_n(TestResultsSet& tc)
 #if SIMDPP_HAS_INT32_SHIFT_R_BY_VECTOR
     TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, shift_r, data, shift);
 #endif
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_r, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_r, data, shift);
 }
 
 template<unsigned B>
@@ -193,6 +249,35 @@ void test_math_shift_int64_n(TestResultsSet& tc)
     TemplateTestArrayHelper<Test_shift_l, IV>::run(tc, v.i64, vnum);
     TemplateTestArrayHelper<Test_shift_r, UV>::run(tc, v.u64, vnum);
     TemplateTestArrayHelper<Test_shift_r, IV>::run(tc, v.i64, vnum);
+    TemplateTestArrayHelper<Test_rotate, UV>::run(tc, v.u64, vnum);
+    TemplateTestArrayHelper<Test_rotate, IV>::run(tc, v.i64, vnum);
+    TemplateTestArrayHelper<Test_shift2, UV>::run(tc, v.u64, v.u64 + 1, vnum - 1);
+    TemplateTestArrayHelper<Test_shift2, IV>::run(tc, v.i64, v.i64 + 1, vnum - 1);
+
+    TestData<UV> shift;
+    for (unsigned i = 0; i < 64; ++i) {
+        shift.add(make_uint(i));
+    }
+    shift.add(make_uint(0, 1));
+    shift.add(make_uint(2, 3));
+    shift.add(make_uint(63, 64));
+    shift.add(make_uint(65, 0xffffffffffffffff));
+
+    TestData<UV> data;
+    data.add(make_uint(0));
+    data.add(make_uint(0xffffffffffffffff));
+    data.add(make_uint(0xffffffffffffffff, 0));
+    data.add(make_uint(0, 0xffffffffffffffff));
+    data.add(make_uint(0x5555555555555555));
+    data.add(make_uint(0xaaaaaaaaaaaaaaaa));
+    data.add(make_uint(0xa00000000000000a));
+    data.add(make_uint(0xa00000000000000a, 0));
+    data.add(make_uint(0x0123456789abcdef, 0xfedcba9876543210));
+
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, UV, UV, UV, rotate_r, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_l, data, shift);
+    TEST_PUSH_ALL_COMB_OP2_SEPARATE_T(tc, IV, IV, UV, rotate_r, data, shift);
 }
 
 void test_math_shift(TestResults& res)
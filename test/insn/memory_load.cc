@@ -104,6 +104,102 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr,
     TEST_NOT_EQUAL(tr, zero, rv[3]);
 }
 
+template<class V>
+void test_load_expand(TestResultsSet& tc, TestReporter& tr,
+                      const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    for (unsigned j = 0; j < 8; ++j) {
+        // j == 0 selects no elements, j == 7 selects all. The source is
+        // offset by one element so that unaligned loads are tested.
+        unsigned num_loaded = 0;
+        for (unsigned i = 0; i < V::length; ++i) {
+            bool selected = (i * 5 + j * 3) % 7 < j;
+            mdata[i] = selected ? 1 : 0;
+            edata[i] = selected ? sdata[1 + num_loaded++] : 0;
+        }
+        V mv = load(mdata);
+        typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+        V r = load_expand(sdata + 1, mask);
+        V expected = load(edata);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
+template<class V>
+void test_load_be(TestResultsSet& tc, TestReporter& tr,
+                  const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    // bdata holds the elements of sdata in big-endian byte order
+    SIMDPP_ALIGN(64) E bdata[V::length + 1];
+    for (unsigned i = 0; i < V::length + 1; ++i) {
+        const char* src = reinterpret_cast<const char*>(sdata + i);
+        char* dst = reinterpret_cast<char*>(bdata + i);
+        for (unsigned j = 0; j < sizeof(E); ++j) {
+#if SIMDPP_BIG_ENDIAN
+            dst[j] = src[j];
+#else
+            dst[j] = src[sizeof(E) - 1 - j];
+#endif
+        }
+    }
+
+    for (unsigned i = 0; i < 2; ++i) {
+        V r = load_be<V>(bdata + i);
+        V expected = load_u(sdata + i);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
+template<class V>
+void test_gather(TestResultsSet& tc, TestReporter& tr,
+                 const typename V::element_type* sdata, unsigned size)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) int32_t idata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    for (unsigned j = 0; j < 4; ++j) {
+        for (unsigned i = 0; i < V::length; ++i) {
+            idata[i] = (i * 7 + j * 5) % size;
+            mdata[i] = (i + j) % 3 != 0 ? 1 : 0;
+        }
+        int32<V::length> idx = load(idata);
+        V mv = load(mdata);
+        typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+        V r = gather(sdata, idx);
+        for (unsigned i = 0; i < V::length; ++i) {
+            edata[i] = sdata[idata[i]];
+        }
+        V expected = load(edata);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+
+        r = gather_masked(sdata, idx, mask);
+        for (unsigned i = 0; i < V::length; ++i) {
+            edata[i] = mdata[i] != 0 ? sdata[idata[i]] : 0;
+        }
+        expected = load(edata);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
 template<unsigned B>
 void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -125,6 +221,50 @@ void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 
     test_load_helper<float32<B/4>, vnum>(tc, tr, v.pf32);
     test_load_helper<float64<B/8>, vnum>(tc, tr, v.pf64);
+
+    test_load_expand<uint8<B>>(tc, tr, v.pu8);
+    test_load_expand<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_expand<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_expand<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_expand<int8<B>>(tc, tr, v.pi8);
+    test_load_expand<int16<B/2>>(tc, tr, v.pi16);
+    test_load_expand<int32<B/4>>(tc, tr, v.pi32);
+    test_load_expand<int64<B/8>>(tc, tr, v.pi64);
+    test_load_expand<float32<B/4>>(tc, tr, v.pf32);
+    test_load_expand<float64<B/8>>(tc, tr, v.pf64);
+
+    test_load_be<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_be<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_be<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_be<int16<B/2>>(tc, tr, v.pi16);
+    test_load_be<int32<B/4>>(tc, tr, v.pi32);
+    test_load_be<int64<B/8>>(tc, tr, v.pi64);
+}
+
+template<unsigned B>
+void test_memory_gather32_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned vnum = 4;
+    Vectors<B,vnum> v;
+
+    test_gather<uint32<B/4>>(tc, tr, v.pu32, vnum * B/4);
+    test_gather<int32<B/4>>(tc, tr, v.pi32, vnum * B/4);
+    test_gather<float32<B/4>>(tc, tr, v.pf32, vnum * B/4);
+}
+
+// Vectors of 64-bit elements need index vectors of half the size, thus the
+// smallest supported vectors are 256-bit
+template<unsigned B>
+void test_memory_gather64_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    const unsigned vnum = 4;
+    Vectors<B,vnum> v;
+
+    test_gather<uint64<B/8>>(tc, tr, v.pu64, vnum * B/8);
+    test_gather<int64<B/8>>(tc, tr, v.pi64, vnum * B/8);
+    test_gather<float64<B/8>>(tc, tr, v.pf64, vnum * B/8);
 }
 
 void test_memory_load(TestResults& res, TestReporter& tr)
@@ -134,6 +274,13 @@ void test_memory_load(TestResults& res, TestReporter& tr)
     test_memory_load_n<16>(tc, tr);
     test_memory_load_n<32>(tc, tr);
     test_memory_load_n<64>(tc, tr);
+
+    test_memory_gather32_n<16>(tc, tr);
+    test_memory_gather32_n<32>(tc, tr);
+    test_memory_gather32_n<64>(tc, tr);
+    test_memory_gather64_n<32>(tc, tr);
+    test_memory_gather64_n<64>(tc, tr);
+    test_memory_gather64_n<128>(tc, tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
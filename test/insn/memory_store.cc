@@ -49,6 +49,127 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
 
 }
 
+template<class V>
+void test_store_compress(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    E expected[V::length];
+    // one extra element so that stores to unaligned locations are tested
+    E rdata[V::length + 1];
+
+    store(sdata, sv[0]);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 8; ++j) {
+        // j == 0 selects no elements, j == 7 selects all
+        unsigned num_expected = 0;
+        for (unsigned i = 0; i < V::length; ++i) {
+            bool selected = (i * 5 + j * 3) % 7 < j;
+            mdata[i] = selected ? 1 : 0;
+            if (selected) {
+                expected[num_expected++] = sdata[i];
+            }
+        }
+        V mv = load(mdata);
+        typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+        std::memset(rdata, 0, sizeof(rdata));
+        unsigned count = store_compress(rdata + 1, sv[0], mask);
+        TEST_EQUAL(tr, count, num_expected);
+        TEST_EQUAL_MEMORY(tr, expected, rdata + 1, num_expected);
+
+        // the contents past the stored elements are unspecified
+        std::memset(rdata + 1 + num_expected, 0,
+                    (V::length - num_expected) * sizeof(E));
+        TEST_PUSH_STORED(tc, V, rdata + 1, 1);
+    }
+}
+
+template<class V>
+void test_store_be(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    E expected[V::length];
+    // one extra element so that stores to unaligned locations are tested
+    E rdata[V::length + 1];
+
+    store(sdata, sv[0]);
+    for (unsigned i = 0; i < V::length; ++i) {
+        const char* src = reinterpret_cast<const char*>(sdata + i);
+        char* dst = reinterpret_cast<char*>(expected + i);
+        for (unsigned j = 0; j < sizeof(E); ++j) {
+#if SIMDPP_BIG_ENDIAN
+            dst[j] = src[j];
+#else
+            dst[j] = src[sizeof(E) - 1 - j];
+#endif
+        }
+    }
+
+    tc.reset_seq();
+    for (unsigned i = 0; i < 2; ++i) {
+        std::memset(rdata, 0, sizeof(rdata));
+        store_be(rdata + i, sv[0]);
+        TEST_PUSH_STORED(tc, V, rdata + i, 1);
+        TEST_EQUAL_MEMORY(tr, expected, rdata + i, V::length);
+    }
+}
+
+template<class V>
+void test_scatter(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned size = V::length * 2;
+
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    SIMDPP_ALIGN(64) int32_t idata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E rdata[size];
+    E expected[size];
+
+    store(sdata, sv[0]);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 4; ++j) {
+        for (unsigned i = 0; i < V::length; ++i) {
+            // j == 3 stores to each location twice
+            idata[i] = j == 3 ? i / 2 : (i * 7 + j * 5) % size;
+            mdata[i] = (i + j) % 3 != 0 ? 1 : 0;
+        }
+        int32<V::length> idx = load(idata);
+        V mv = load(mdata);
+        typename V::mask_vector_type mask = bit_not(cmp_eq(mv, 0));
+
+        std::memset(rdata, 0, sizeof(rdata));
+        std::memset(expected, 0, sizeof(expected));
+        scatter(rdata, idx, sv[0]);
+        for (unsigned i = 0; i < V::length; ++i) {
+            expected[idata[i]] = sdata[i];
+        }
+        TEST_PUSH_STORED(tc, V, rdata, 2);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, size);
+
+        std::memset(rdata, 0, sizeof(rdata));
+        std::memset(expected, 0, sizeof(expected));
+        scatter_masked(rdata, idx, sv[0], mask);
+        for (unsigned i = 0; i < V::length; ++i) {
+            if (mdata[i] != 0) {
+                expected[idata[i]] = sdata[i];
+            }
+        }
+        TEST_PUSH_STORED(tc, V, rdata, 2);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, size);
+    }
+}
+
 template<class V, unsigned vnum>
 void test_store_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
 {
@@ -188,6 +309,48 @@ void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
     test_store_masked<int64<B/8>>(tc, tr, v.i64);
     test_store_masked<float32<B/4>>(tc, tr, v.f32);
     test_store_masked<float64<B/8>>(tc, tr, v.f64);
+
+    test_store_compress<uint8<B>>(tc, tr, v.u8);
+    test_store_compress<uint16<B/2>>(tc, tr, v.u16);
+    test_store_compress<uint32<B/4>>(tc, tr, v.u32);
+    test_store_compress<uint64<B/8>>(tc, tr, v.u64);
+    test_store_compress<int8<B>>(tc, tr, v.i8);
+    test_store_compress<int16<B/2>>(tc, tr, v.i16);
+    test_store_compress<int32<B/4>>(tc, tr, v.i32);
+    test_store_compress<int64<B/8>>(tc, tr, v.i64);
+    test_store_compress<float32<B/4>>(tc, tr, v.f32);
+    test_store_compress<float64<B/8>>(tc, tr, v.f64);
+
+    test_store_be<uint16<B/2>>(tc, tr, v.u16);
+    test_store_be<uint32<B/4>>(tc, tr, v.u32);
+    test_store_be<uint64<B/8>>(tc, tr, v.u64);
+    test_store_be<int16<B/2>>(tc, tr, v.i16);
+    test_store_be<int32<B/4>>(tc, tr, v.i32);
+    test_store_be<int64<B/8>>(tc, tr, v.i64);
+}
+
+template<unsigned B>
+void test_memory_scatter32_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    Vectors<B,4> v;
+
+    test_scatter<uint32<B/4>>(tc, tr, v.u32);
+    test_scatter<int32<B/4>>(tc, tr, v.i32);
+    test_scatter<float32<B/4>>(tc, tr, v.f32);
+}
+
+// Vectors of 64-bit elements need index vectors of half the size, thus the
+// smallest supported vectors are 256-bit
+template<unsigned B>
+void test_memory_scatter64_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    Vectors<B,4> v;
+
+    test_scatter<uint64<B/8>>(tc, tr, v.u64);
+    test_scatter<int64<B/8>>(tc, tr, v.i64);
+    test_scatter<float64<B/8>>(tc, tr, v.f64);
 }
 
 void test_memory_store(TestResults& res, TestReporter& tr)
@@ -197,6 +360,13 @@ void test_memory_store(TestResults& res, TestReporter& tr)
     test_memory_store_n<16>(tc, tr);
     test_memory_store_n<32>(tc, tr);
     test_memory_store_n<64>(tc, tr);
+
+    test_memory_scatter32_n<16>(tc, tr);
+    test_memory_scatter32_n<32>(tc, tr);
+    test_memory_scatter32_n<64>(tc, tr);
+    test_memory_scatter64_n<32>(tc, tr);
+    test_memory_scatter64_n<64>(tc, tr);
+    test_memory_scatter64_n<128>(tc, tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,88 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include "../common/vectors.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void test_permute_var_v(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using U = typename V::uint_vector_type;
+    using UE = typename U::element_type;
+    const unsigned N = V::length;
+
+    SIMDPP_ALIGN(64) E adata[N];
+    SIMDPP_ALIGN(64) E bdata[N];
+    SIMDPP_ALIGN(64) UE idata[N];
+    SIMDPP_ALIGN(64) E rdata[N];
+    E expected[N];
+
+    store(adata, sv[0]);
+    store(bdata, sv[1]);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 4; ++j) {
+        // the indices wrap around the table several times so that the
+        // handling of the unused upper bits is tested too
+        for (unsigned i = 0; i < N; ++i) {
+            idata[i] = UE(i * 5 + j * (N * 3 + 7));
+        }
+        U idx = load(idata);
+
+        for (unsigned i = 0; i < N; ++i) {
+            expected[i] = adata[idata[i] % N];
+        }
+        V r = permute_var(sv[0], idx);
+        store(rdata, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+        TEST_PUSH(tc, V, r);
+
+        for (unsigned i = 0; i < N; ++i) {
+            unsigned k = idata[i] % (N * 2);
+            expected[i] = k < N ? adata[k] : bdata[k - N];
+        }
+        r = shuffle_var(sv[0], sv[1], idx);
+        store(rdata, r);
+        TEST_EQUAL_MEMORY(tr, expected, rdata, N);
+        TEST_PUSH(tc, V, r);
+    }
+}
+
+template<unsigned B>
+void test_permute_var_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+    Vectors<B,2> v;
+
+    test_permute_var_v<uint8<B>>(tc, tr, v.u8);
+    test_permute_var_v<uint16<B/2>>(tc, tr, v.u16);
+    test_permute_var_v<uint32<B/4>>(tc, tr, v.u32);
+    test_permute_var_v<uint64<B/8>>(tc, tr, v.u64);
+    test_permute_var_v<int8<B>>(tc, tr, v.i8);
+    test_permute_var_v<int16<B/2>>(tc, tr, v.i16);
+    test_permute_var_v<int32<B/4>>(tc, tr, v.i32);
+    test_permute_var_v<int64<B/8>>(tc, tr, v.i64);
+    test_permute_var_v<float32<B/4>>(tc, tr, v.f32);
+    test_permute_var_v<float64<B/8>>(tc, tr, v.f64);
+}
+
+void test_permute_var(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& tc = res.new_results_set("permute_var");
+    test_permute_var_n<16>(tc, tr);
+    test_permute_var_n<32>(tc, tr);
+    test_permute_var_n<64>(tc, tr);
+    test_permute_var_n<128>(tc, tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
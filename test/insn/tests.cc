@@ -63,6 +63,7 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
     test_shuffle_generic(res);
     test_shuffle(res);
     test_shuffle_bytes(res, tr);
+    test_permute_var(res, tr);
 
     test_convert(res);
     test_math_fp(res, opts);
@@ -74,6 +75,9 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
     test_for_each(res, tr);
 
     test_algorithm_bitonic_sort(tr);
+    test_algorithm_sort(tr);
+    test_algorithm_radix_sort(tr);
+    test_algorithm_partition(tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
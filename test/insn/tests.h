@@ -34,10 +34,14 @@ void test_shuffle(TestResults& res);
 void test_shuffle_bytes(TestResults& res, TestReporter& tr);
 void test_shuffle_generic(TestResults& res);
 void test_permute_generic(TestResults& res);
+void test_permute_var(TestResults& res, TestReporter& tr);
 void test_shuffle_transpose(TestResults& res);
 void test_test_utils(TestResults& res);
 void test_transpose(TestResults& res);
 void test_algorithm_bitonic_sort(TestReporter& tr);
+void test_algorithm_sort(TestReporter& tr);
+void test_algorithm_radix_sort(TestReporter& tr);
+void test_algorithm_partition(TestReporter& tr);
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 
@@ -9,135 +9,244 @@
 #define SIMDPP_TEST_MATH_ACCURACY_ACCURACY_TRACKER_H
 
 #include <simdpp/core/aligned_allocator.h>
+#include "accuracy_table.h"
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <vector>
 
-inline float fast_next_value_to_inf(float a)
+template<class T> struct AccuracyCheckerIntType;
+template<> struct AccuracyCheckerIntType<float> { using type = std::int32_t; };
+template<> struct AccuracyCheckerIntType<double> { using type = std::int64_t; };
+
+// Returns the value that is @a n representable values further from zero
+template<class T>
+T advance_value_to_inf(T a, std::int64_t n)
 {
-    int a_int = 0;
+    using I = typename AccuracyCheckerIntType<T>::type;
+    I a_int = 0;
     std::memcpy(&a_int, &a, sizeof(a));
-    a_int++;
+    a_int += I(n);
     std::memcpy(&a, &a_int, sizeof(a));
     return a;
 }
 
+template<class T>
+T fast_next_value_to_inf(T a)
+{
+    return advance_value_to_inf(a, 1);
+}
+
+/*  Returns the number of representable values between @a a and @a b. If only
+    one of the values is NaN, the maximum representable distance is returned.
+*/
+template<class T>
+std::uint64_t ulp_distance(T a, T b)
+{
+    using I = typename AccuracyCheckerIntType<T>::type;
+    if (std::isnan(a) || std::isnan(b)) {
+        return std::isnan(a) && std::isnan(b) ? 0 : UINT64_MAX;
+    }
+    // map the sign-magnitude representation to a monotonic integer one
+    auto ordered = [](T x) {
+        I x_int = 0;
+        std::memcpy(&x_int, &x, sizeof(x));
+        std::int64_t r = x_int & std::numeric_limits<I>::max();
+        return x_int < 0 ? -r : r;
+    };
+    std::int64_t a_ord = ordered(a);
+    std::int64_t b_ord = ordered(b);
+    return a_ord > b_ord ? std::uint64_t(a_ord - b_ord) : std::uint64_t(b_ord - a_ord);
+}
+
 template<class T>
 class AccuracyChecker {
 public:
+    // Sets the number of values that each thread checks at once
     void set_scratchpad_size(std::size_t size)
     {
         scratchpad_size_ = size;
     }
 
+    /*  Sets the ranges of values to check. Each range is specified by its
+        first and last value and must not cross zero. The first value must be
+        the one closer to zero.
+    */
     void set_bounds(const std::vector<std::pair<T, T>>& bounds)
     {
         bounds_ = bounds;
     }
 
+    /*  Checks only every @a stride-th representable value within the bounds
+        starting from the first value. The last value of a range is checked
+        only if the distance to it is a multiple of the stride.
+    */
+    void set_stride(std::uint64_t stride)
+    {
+        stride_ = stride;
+    }
+
+    /*  Checks all values within the bounds. The bounds are split into shards
+        of the size of the scratchpad which are checked in parallel, each
+        thread using its own scratchpads. Thus @a expected_cb and @a check_cb
+        may be invoked concurrently from multiple threads. The results are
+        merged in the order of the shards, so they don't depend on the number
+        of threads.
+    */
     template<class FExpected, class FCheck>
     void run_check(FExpected&& expected_cb, FCheck&& check_cb)
     {
-        source_scratchpad_.resize(scratchpad_size_);
-        dest_expected_scratchpad_.resize(scratchpad_size_);
-        dest_check_scratchpad_.resize(scratchpad_size_);
-
-        if (bounds_.empty()) {
-            return;
-        }
-
-        std::size_t curr_bounds_i = 0;
-        T curr_value = bounds_.front().first;
-        T target_value = bounds_.front().second;
-
-        while (true) {
-            std::size_t scratchpad_valid_size = 0;
-
-            for (std::uint32_t i = 0; i < scratchpad_size_; ++i) {
-
-                source_scratchpad_[i] = curr_value;
-                scratchpad_valid_size = i;
-
-                if (std::memcmp(&curr_value, &target_value, sizeof(curr_value)) == 0) {
-                    curr_bounds_i++;
-                    if (curr_bounds_i == bounds_.size()) {
-                        break;
-                    }
-
-                    curr_value = bounds_[curr_bounds_i].first;
-                    target_value = bounds_[curr_bounds_i].second;
-                } else {
-                    curr_value = fast_next_value_to_inf(curr_value);
+        std::vector<Shard> shards = make_shards();
+        std::vector<Results> shard_results(shards.size());
+
+        #pragma omp parallel
+        {
+            Scratchpad source_scratchpad(scratchpad_size_ + 32);
+            Scratchpad dest_expected_scratchpad(scratchpad_size_ + 32);
+            Scratchpad dest_check_scratchpad(scratchpad_size_ + 32);
+
+            // the loop variable must be signed for OpenMP 2.0
+            #pragma omp for schedule(dynamic)
+            for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(shards.size()); ++i) {
+                const Shard& shard = shards[i];
+                std::size_t size = shard.count;
+                for (std::size_t j = 0; j < size; ++j) {
+                    source_scratchpad[j] = advance_value_to_inf(shard.first,
+                                                                std::int64_t(j * stride_));
                 }
-            }
-            scratchpad_valid_size++;
 
-            // ensure that the amount of data aligns with SIMD vector sizes
-            while (scratchpad_valid_size % 32 != 0) {
-                source_scratchpad_[scratchpad_valid_size] =
-                    source_scratchpad_[scratchpad_valid_size - 1];
-                scratchpad_valid_size++;
-            }
+                // ensure that the amount of data aligns with SIMD vector sizes
+                std::size_t padded_size = size;
+                while (padded_size % 32 != 0) {
+                    source_scratchpad[padded_size] = source_scratchpad[size - 1];
+                    padded_size++;
+                }
 
-            #pragma omp parallel
-            {
-                #pragma omp single nowait
-                expected_cb(source_scratchpad_.data(), dest_expected_scratchpad_.data(),
-                            scratchpad_valid_size);
+                expected_cb(source_scratchpad.data(), dest_expected_scratchpad.data(),
+                            padded_size);
+                check_cb(source_scratchpad.data(), dest_check_scratchpad.data(),
+                         padded_size);
 
-                #pragma omp single nowait
-                check_cb(source_scratchpad_.data(), dest_check_scratchpad_.data(),
-                         scratchpad_valid_size);
+                Results& results = shard_results[i];
+                for (std::size_t j = 0; j < size; ++j) {
+                    results.submit(source_scratchpad[j], dest_expected_scratchpad[j],
+                                   dest_check_scratchpad[j]);
+                }
             }
+        }
 
-            submit_scratchpads(scratchpad_valid_size);
-
-            if (curr_bounds_i == bounds_.size()) {
-                break;
-            }
+        for (const Results& results : shard_results) {
+            results_.merge(results);
         }
     }
 
+    // Prints the results and adds them to the accuracy table
     void describe(const std::string& name)
     {
         std::cout << "Check " << name
-                  << ": abs diff " << max_abs_diff_ << " at " << max_abs_at_
-                  << " rel diff " << max_rel_diff_ << " at " << max_rel_at_ << "\n";
+                  << ": abs diff " << results_.max_abs_diff << " at " << results_.max_abs_at
+                  << " rel diff " << results_.max_rel_diff << " at " << results_.max_rel_at
+                  << " ulp diff " << results_.max_ulp_diff << " at " << results_.max_ulp_at
+                  << " mean ulp diff " << mean_ulp_diff() << "\n";
+        accuracy_table_add(name, results_.max_ulp_diff, mean_ulp_diff());
     }
-private:
 
-    void submit_scratchpads(std::size_t size)
+    std::uint64_t max_ulp_diff() const
     {
-        for (std::size_t i = 0; i < size; ++i) {
-            T expected = dest_expected_scratchpad_[i];
-            T result = dest_check_scratchpad_[i];
-            T input = source_scratchpad_[i];
+        return results_.max_ulp_diff;
+    }
 
+    double mean_ulp_diff() const
+    {
+        return results_.num_checked == 0 ? 0.0 : results_.sum_ulp_diff / results_.num_checked;
+    }
+private:
+    // aligned for the widest vectors, as the checked functions use aligned loads
+    using Scratchpad = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+    // A contiguous part of one of the ranges
+    struct Shard {
+        T first;
+        std::uint64_t count;
+    };
+
+    struct Results {
+        T max_rel_at = 0;
+        T max_rel_diff = 0;
+        T max_abs_at = 0;
+        T max_abs_diff = 0;
+        T max_ulp_at = 0;
+        std::uint64_t max_ulp_diff = 0;
+        double sum_ulp_diff = 0;
+        std::uint64_t num_checked = 0;
+
+        void submit(T input, T expected, T result)
+        {
             T abs_diff = std::fabs(expected - result);
             T rel_diff = std::fabs((expected - result) / expected);
 
-            if (abs_diff > max_abs_diff_) {
-                max_abs_diff_ = abs_diff;
-                max_abs_at_ = input;
+            if (abs_diff > max_abs_diff) {
+                max_abs_diff = abs_diff;
+                max_abs_at = input;
             }
-            if (rel_diff > max_rel_diff_) {
-                max_rel_diff_ = rel_diff;
-                max_rel_at_ = input;
+            if (rel_diff > max_rel_diff) {
+                max_rel_diff = rel_diff;
+                max_rel_at = input;
+            }
+
+            std::uint64_t ulp_diff = ulp_distance(expected, result);
+            sum_ulp_diff += double(ulp_diff);
+            if (ulp_diff > max_ulp_diff) {
+                max_ulp_diff = ulp_diff;
+                max_ulp_at = input;
+            }
+            num_checked++;
+        }
+
+        // On ties the location within the current results is kept
+        void merge(const Results& other)
+        {
+            if (other.max_abs_diff > max_abs_diff) {
+                max_abs_diff = other.max_abs_diff;
+                max_abs_at = other.max_abs_at;
+            }
+            if (other.max_rel_diff > max_rel_diff) {
+                max_rel_diff = other.max_rel_diff;
+                max_rel_at = other.max_rel_at;
+            }
+            if (other.max_ulp_diff > max_ulp_diff) {
+                max_ulp_diff = other.max_ulp_diff;
+                max_ulp_at = other.max_ulp_at;
+            }
+            sum_ulp_diff += other.sum_ulp_diff;
+            num_checked += other.num_checked;
+        }
+    };
+
+    std::vector<Shard> make_shards() const
+    {
+        std::vector<Shard> shards;
+        for (const auto& bound : bounds_) {
+            std::uint64_t count = ulp_distance(bound.first, bound.second) / stride_ + 1;
+            T first = bound.first;
+            while (count > 0) {
+                std::uint64_t shard_count = std::min<std::uint64_t>(count, scratchpad_size_);
+                shards.push_back({first, shard_count});
+                first = advance_value_to_inf(first, std::int64_t(shard_count * stride_));
+                count -= shard_count;
             }
         }
+        return shards;
     }
 
-    std::size_t scratchpad_size_ = 128 * 1024 * 1024;
-    T max_rel_at_ = 0;
-    T max_rel_diff_ = 0;
-    T max_abs_at_ = 0;
-    T max_abs_diff_ = 0;
+    std::size_t scratchpad_size_ = 1024 * 1024;
+    std::uint64_t stride_ = 1;
     std::vector<std::pair<T, T>> bounds_;
-    std::vector<T, simdpp::aligned_allocator<T, sizeof(T)>> source_scratchpad_;
-    std::vector<T, simdpp::aligned_allocator<T, sizeof(T)>> dest_expected_scratchpad_;
-    std::vector<T, simdpp::aligned_allocator<T, sizeof(T)>> dest_check_scratchpad_;
+    Results results_;
 };
 
 #endif
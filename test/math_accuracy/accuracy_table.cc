@@ -0,0 +1,179 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "accuracy_table.h"
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+struct AccuracyTableRow {
+    std::string function;
+    std::string tier;
+    std::string type;
+    std::string arch;
+    std::uint64_t max_ulp;
+    double mean_ulp;
+    int bound;
+};
+
+const int unchecked = -1;
+
+/*  The maximum errors in ULP as documented by the functions. This is the
+    list that simdpp/math/accuracy.h refers to. The columns are the ulp1, ulp4
+    and fast tiers for float32 and then for float64. Functions without
+    accuracy tiers use the ulp1 column. Checks whose name contains arguments or the
+    name of a particular result, e.g. "pow(x, 2.5)" or "sincos.sin", use the
+    bounds of the function name before the parenthesis or the dot.
+*/
+struct AccuracyBound {
+    const char* function;
+    int float32[3];
+    int float64[3];
+};
+
+const AccuracyBound g_bounds[] = {
+    { "exp",            { 1, 1, unchecked }, { 1, 1, unchecked } },
+    { "exp2",           { 1, 1, 1 }, { 1, 1, 1 } },
+    { "expm1",          { 1, 1, 1 }, { 1, 2, 2 } },
+    { "log",            { 1, 4, 4 }, { 1, 4, 4 } },
+    { "log2",           { 1, 4, unchecked }, { 1, 4, unchecked } },
+    { "log10",          { 1, 4, 4 }, { 1, 4, 4 } },
+    { "log1p",          { 1, 4, 4 }, { 1, 4, 4 } },
+    { "sin",            { 1, 1, 1 }, { 1, 1, 1 } },
+    { "cos",            { 1, 1, 1 }, { 1, 1, 1 } },
+    { "sincos",         { 1, 1, 1 }, { 1, 1, 1 } },
+    { "tan",            { 1, 2, 2 }, { 1, 2, 2 } },
+    { "sin_bounded",    { 1, 1, 1 }, { 1, 1, 1 } },
+    { "cos_bounded",    { 1, 1, 1 }, { 1, 1, 1 } },
+    { "tan_bounded",    { 1, 2, 2 }, { 1, 2, 2 } },
+    { "atan",           { 1, 4, 4 }, { 1, 4, 4 } },
+    { "atan2",          { 1, 4, 4 }, { 1, 4, 4 } },
+    { "asin",           { 1, 4, 4 }, { 1, 4, 4 } },
+    { "acos",           { 1, 4, 4 }, { 1, 4, 4 } },
+    { "pow",            { 1, 1, 1 }, { 1, 1, 1 } },
+    { "cbrt",           { 1, 1, 1 }, { 1, 1, 1 } },
+    { "hypot",          { 1, 1, 1 }, { 1, 1, 1 } },
+    { "tanh",           { 1, 1, unchecked }, { 1, 1, unchecked } },
+    { "sigmoid",        { 1, 2, unchecked }, { 1, 2, unchecked } },
+    { "erf",            { 1, 2, unchecked }, { 1, 2, unchecked } },
+    { "gelu",           { 1, 1, unchecked }, { 1, 1, unchecked } },
+    { "gelu_tanh",      { 1, 4, unchecked }, { 1, 3, unchecked } },
+    { "frexp",          { 0, 0, 0 }, { 0, 0, 0 } },
+    { "ldexp",          { 0, 0, 0 }, { 0, 0, 0 } },
+    { "ilogb",          { 0, 0, 0 }, { 0, 0, 0 } },
+    { "log2_approx",    { unchecked, unchecked, unchecked },
+                        { unchecked, unchecked, unchecked } },
+    { "log2_approx_positive_finite", { unchecked, unchecked, unchecked },
+                                     { unchecked, unchecked, unchecked } },
+    { "rsqrt_newton<1>", { unchecked, unchecked, unchecked },
+                         { unchecked, unchecked, unchecked } },
+    { "rsqrt_newton<2>", { 2, 2, 2 }, { unchecked, unchecked, unchecked } },
+    { "rsqrt_newton<3>", { unchecked, unchecked, unchecked },
+                         { unchecked, unchecked, unchecked } },
+    { "rsqrt_newton<4>", { unchecked, unchecked, unchecked }, { 2, 2, 2 } },
+    { "sqrt_newton<2>", { 4, 4, 4 }, { unchecked, unchecked, unchecked } },
+    { "sqrt_newton<4>", { unchecked, unchecked, unchecked }, { 3, 3, 3 } },
+};
+
+std::string g_current_arch;
+std::vector<AccuracyTableRow> g_rows;
+unsigned g_num_failures = 0;
+
+bool ends_with(const std::string& str, const std::string& suffix)
+{
+    return str.size() >= suffix.size() &&
+        str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Removes the "(type)" or "<tier>" suffix from @a name and returns it
+std::string split_suffix(std::string& name, char open, char close,
+                         const std::vector<std::string>& known)
+{
+    for (const auto& k : known) {
+        std::string suffix = open + k + close;
+        if (ends_with(name, suffix)) {
+            name.erase(name.size() - suffix.size());
+            return k;
+        }
+    }
+    return "-";
+}
+
+// Returns the documented bound of the row, unchecked if there's none
+bool find_bound(const AccuracyTableRow& row, int& bound)
+{
+    std::string function = row.function.substr(0, row.function.find_first_of("(."));
+    unsigned tier = row.tier == "ulp4" ? 1 : row.tier == "fast" ? 2 : 0;
+
+    for (const auto& b : g_bounds) {
+        if (function == b.function) {
+            bound = row.type == "float64" ? b.float64[tier] : b.float32[tier];
+            return true;
+        }
+    }
+    bound = unchecked;
+    return false;
+}
+
+} // namespace
+
+void accuracy_table_set_arch(const std::string& arch)
+{
+    g_current_arch = arch;
+}
+
+void accuracy_table_add(const std::string& check_name,
+                        std::uint64_t max_ulp, double mean_ulp)
+{
+    AccuracyTableRow row;
+    row.function = check_name;
+    row.type = split_suffix(row.function, '(', ')', {"float32", "float64"});
+    row.tier = split_suffix(row.function, '<', '>', {"ulp1", "ulp4", "fast"});
+    row.arch = g_current_arch;
+    row.max_ulp = max_ulp;
+    row.mean_ulp = mean_ulp;
+
+    if (!find_bound(row, row.bound)) {
+        accuracy_table_add_failure(check_name, "no documented error bound");
+    } else if (row.bound != unchecked && max_ulp > std::uint64_t(row.bound)) {
+        accuracy_table_add_failure(check_name, "max error " + std::to_string(max_ulp) +
+                                   " ULP exceeds the documented bound of " +
+                                   std::to_string(row.bound) + " ULP");
+    }
+    g_rows.push_back(row);
+}
+
+void accuracy_table_add_failure(const std::string& check_name,
+                                const std::string& message)
+{
+    std::cerr << "FAIL: " << check_name << " on " << g_current_arch << ": "
+              << message << "\n";
+    g_num_failures++;
+}
+
+unsigned accuracy_table_num_failures()
+{
+    return g_num_failures;
+}
+
+void accuracy_table_write(std::ostream& out)
+{
+    out << "function\ttier\ttype\tarch\tmax_ulp\tmean_ulp\tbound_ulp\n";
+    for (const auto& row : g_rows) {
+        out << row.function << '\t' << row.tier << '\t' << row.type << '\t'
+            << row.arch << '\t' << row.max_ulp << '\t'
+            << std::setprecision(6) << row.mean_ulp << '\t';
+        if (row.bound == unchecked) {
+            out << "-\n";
+        } else {
+            out << row.bound << '\n';
+        }
+    }
+}
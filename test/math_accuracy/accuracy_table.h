@@ -0,0 +1,44 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SIMDPP_TEST_MATH_ACCURACY_ACCURACY_TABLE_H
+#define SIMDPP_TEST_MATH_ACCURACY_ACCURACY_TABLE_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/*  Collects the results of all accuracy checks into a table with one row per
+    function, accuracy tier, element type and architecture. The check names
+    have the form "function<tier>(type)", e.g. "log<ulp4>(float32)". Checks
+    of functions that don't have accuracy tiers have no tier suffix, in which
+    case the tier column contains "-".
+
+    The table is written as tab-separated values with a header row, so that
+    it can be consumed by scripts that select the cheapest tier satisfying a
+    given tolerance.
+
+    Each row is compared against the maximum error that is documented for
+    the function, tier and element type (see simdpp/math/accuracy.h). Rows
+    that exceed it and rows of functions that have no documented bound are
+    reported as failures. The tiers whose error is documented as absolute or
+    relative error are not checked.
+*/
+void accuracy_table_set_arch(const std::string& arch);
+
+void accuracy_table_add(const std::string& check_name,
+                        std::uint64_t max_ulp, double mean_ulp);
+
+// Reports a failure of a check that is not expressed as ULP error
+void accuracy_table_add_failure(const std::string& check_name,
+                                const std::string& message);
+
+unsigned accuracy_table_num_failures();
+
+void accuracy_table_write(std::ostream& out);
+
+#endif
@@ -0,0 +1,175 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/activation.h>
+#include "check_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_tanh(long double x) { return std::tanh(x); }
+long double ref_sigmoid(long double x) { return 1.0L / (1.0L + std::exp(-x)); }
+long double ref_erf(long double x) { return std::erf(x); }
+
+/*  gelu() and gelu_tanh() amplify the relative error of their intermediate
+    argument by up to 2y^2 and |v| respectively, i.e. by up to ~1500 for
+    float64. This exceeds the extra precision of long double, thus the
+    intermediate argument is computed in double-word precision and the low
+    part is applied using the derivative of the outer function.
+*/
+void ref_two_sum(long double a, long double b, long double& s, long double& err)
+{
+    s = a + b;
+    long double bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+}
+
+void ref_two_prod(long double a, long double b, long double& p, long double& err)
+{
+    p = a * b;
+    err = std::fma(a, b, -p);
+}
+
+long double ref_gelu(long double x)
+{
+    const long double rsqrt2_hi = 0.707106781186547524400844362104849039L;
+    const long double rsqrt2_lo = 1.89503255889325236853e-20L;
+    const long double two_over_sqrt_pi = 1.128379167095512573896158903121545172L;
+    if (std::isinf(x)) {
+        return x > 0 ? x : 0.0L;
+    }
+    long double a = std::fabs(x);
+    long double yh, yl;
+    ref_two_prod(a, rsqrt2_hi, yh, yl);
+    yl += a * rsqrt2_lo;
+    long double d = yl * two_over_sqrt_pi * std::exp(-yh * yh);
+    if (x < 0) {
+        return 0.5L * x * (std::erfc(yh) - d);
+    }
+    return 0.5L * x * (1.0L + std::erf(yh) + d);
+}
+
+long double ref_gelu_tanh(long double x)
+{
+    // 2*sqrt(2/pi) and 2*sqrt(2/pi)*0.044715
+    const long double k1_hi = 1.595769121605730711759831204112609147L;
+    const long double k1_lo = 5.35117775572048047393e-20L;
+    const long double k2_hi = 0.0713548162726002487763387522798635L;
+    const long double k2_lo = -8.75006214400900978186e-22L;
+    if (std::isinf(x)) {
+        return x > 0 ? x : 0.0L;
+    }
+    long double sh, sl, ph, pl, wh, wl, vh, vl;
+    ref_two_prod(x, x, sh, sl);
+    ref_two_prod(k2_hi, sh, ph, pl);
+    pl += k2_hi * sl + k2_lo * sh;
+    ref_two_sum(k1_hi, ph, wh, wl);
+    wl += pl + k1_lo;
+    ref_two_prod(x, wh, vh, vl);
+    vl += x * wl;
+    return x / (1.0L + std::exp(-vh) * (1.0L - vl));
+}
+
+const std::vector<double>& activation_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 0.6, 0.84, 1.0, 2.0, 3.5, 5.0, 9.0, 17.5,
+        26.0, 38.0, 700.0, 1e300
+    };
+    return points;
+}
+
+template<class Tag>
+void check_tanh_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("tanh" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::tanh(v, tag)); }, ref_tanh);
+    check_accuracy_float64("tanh" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::tanh(v, tag)); }, ref_tanh,
+        activation_float64_points());
+}
+
+template<class Tag>
+void check_sigmoid_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("sigmoid" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::sigmoid(v, tag)); }, ref_sigmoid);
+    check_accuracy_float64("sigmoid" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::sigmoid(v, tag)); }, ref_sigmoid,
+        activation_float64_points());
+}
+
+template<class Tag>
+void check_erf_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("erf" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::erf(v, tag)); }, ref_erf);
+    check_accuracy_float64("erf" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::erf(v, tag)); }, ref_erf,
+        activation_float64_points());
+}
+
+template<class Tag>
+void check_gelu_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("gelu" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::gelu(v, tag)); }, ref_gelu);
+    check_accuracy_float64("gelu" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::gelu(v, tag)); }, ref_gelu,
+        activation_float64_points());
+}
+
+template<class Tag>
+void check_gelu_tanh_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("gelu_tanh" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::gelu_tanh(v, tag)); }, ref_gelu_tanh);
+    check_accuracy_float64("gelu_tanh" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::gelu_tanh(v, tag)); }, ref_gelu_tanh,
+        activation_float64_points());
+}
+
+} // namespace
+
+void check_tanh_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_tanh_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_sigmoid_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_sigmoid_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_erf_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_erf_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_gelu_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_gelu_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_gelu_tanh_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_gelu_tanh_accuracy_tier(suffix, tag);
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
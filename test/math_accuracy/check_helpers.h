@@ -0,0 +1,142 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SIMDPP_TEST_MATH_ACCURACY_CHECK_HELPERS_H
+#define SIMDPP_TEST_MATH_ACCURACY_CHECK_HELPERS_H
+
+#include <simdpp/simd.h>
+#include <simdpp/math/accuracy.h>
+#include "accuracy_checker.h"
+#include "check_options.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Invokes @a check(suffix, tag) for each accuracy tier. The suffix is
+    appended to the check name so that the tier appears in the accuracy
+    table. Tiers that a function does not implement separately are checked
+    too, since the table should list every tier that can be selected.
+*/
+template<class F>
+void for_each_accuracy_tier(F&& check)
+{
+    check(std::string("<ulp1>"), simdpp::math::ulp1());
+    check(std::string("<ulp4>"), simdpp::math::ulp4());
+    check(std::string("<fast>"), simdpp::math::fast());
+}
+
+/*  Checks all float32 values within @a bounds. The reference values are
+    computed in extended precision so that the rounding of the reference
+    itself does not affect the results.
+*/
+template<class F>
+void check_accuracy_float32(const std::string& name, F&& f, long double (*ref)(long double),
+                            const std::vector<std::pair<float, float>>& bounds)
+{
+    auto expected_func = [ref](const float* src, float* dst, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            *dst++ = static_cast<float>(ref(*src++));
+        }
+    };
+
+    auto check_func = [&f](const float* src, float* dst, std::size_t size) {
+        for (std::size_t i = 0; i < size; i += simdpp::float32v::length) {
+            simdpp::float32v v = simdpp::load(src);
+            v = f(v);
+            simdpp::store(dst, v);
+
+            src += simdpp::float32v::length;
+            dst += simdpp::float32v::length;
+        }
+    };
+
+    AccuracyChecker<float> checker;
+    checker.set_bounds(bounds);
+    checker.run_check(expected_func, check_func);
+    checker.describe(name + "(float32)");
+}
+
+// Checks all float32 values
+template<class F>
+void check_accuracy_float32(const std::string& name, F&& f, long double (*ref)(long double))
+{
+    check_accuracy_float32(name, std::forward<F>(f), ref,
+                           {{0.0f, std::numeric_limits<float>::infinity()},
+                            {-0.0f, -std::numeric_limits<float>::infinity()}});
+}
+
+/*  The float64 range can't be checked exhaustively. Instead, runs of
+    consecutive values are checked at a number of points across the range
+    of the function. In the sampled mode (see check_options.h) values are
+    sampled uniformly across the span of the points instead.
+
+    The negated points are checked too unless @a check_negative is false,
+    which is useful for functions that are defined only for positive
+    arguments.
+*/
+template<class F>
+void check_accuracy_float64(const std::string& name, F&& f, long double (*ref)(long double),
+                            const std::vector<double>& points, bool check_negative = true)
+{
+    auto expected_func = [ref](const double* src, double* dst, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+            *dst++ = static_cast<double>(ref(*src++));
+        }
+    };
+
+    auto check_func = [&f](const double* src, double* dst, std::size_t size) {
+        for (std::size_t i = 0; i < size; i += simdpp::float64v::length) {
+            simdpp::float64v v = simdpp::load(src);
+            v = f(v);
+            simdpp::store(dst, v);
+
+            src += simdpp::float64v::length;
+            dst += simdpp::float64v::length;
+        }
+    };
+
+    const std::int64_t run_length = 1 << 20;
+    std::vector<std::pair<double, double>> bounds;
+    AccuracyChecker<double> checker;
+
+    std::uint64_t samples = check_options_float64_samples();
+    if (samples == 0) {
+        for (double p : points) {
+            bounds.emplace_back(p, advance_value_to_inf(p, run_length));
+            if (check_negative) {
+                bounds.emplace_back(-p, advance_value_to_inf(-p, run_length));
+            }
+        }
+    } else {
+        double lo = std::numeric_limits<double>::infinity();
+        double hi = 0;
+        for (double p : points) {
+            lo = std::min(lo, std::fabs(p));
+            hi = std::max(hi, std::fabs(p));
+        }
+        hi = advance_value_to_inf(hi, run_length);
+        bounds.emplace_back(lo, hi);
+        if (check_negative) {
+            bounds.emplace_back(-lo, -hi);
+        }
+        checker.set_stride(std::max<std::uint64_t>(1, ulp_distance(lo, hi) / samples));
+    }
+
+    checker.set_bounds(bounds);
+    checker.run_check(expected_func, check_func);
+    checker.describe(name + "(float64)");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+#endif
@@ -0,0 +1,24 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "check_options.h"
+
+namespace {
+
+std::uint64_t g_float64_samples = 0;
+
+} // namespace
+
+void check_options_set_float64_samples(std::uint64_t count)
+{
+    g_float64_samples = count;
+}
+
+std::uint64_t check_options_float64_samples()
+{
+    return g_float64_samples;
+}
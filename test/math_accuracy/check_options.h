@@ -0,0 +1,27 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SIMDPP_TEST_MATH_ACCURACY_CHECK_OPTIONS_H
+#define SIMDPP_TEST_MATH_ACCURACY_CHECK_OPTIONS_H
+
+#include <cstdint>
+
+/*  Options that affect all accuracy checks. They are set from the command
+    line before the checks are run.
+
+    If the float64 sample count is nonzero, the float64 checks sample that
+    many values of each sign uniformly across the representations between the
+    smallest and largest check point, instead of checking runs of consecutive
+    values near each check point. This trades the density of the check for
+    the coverage of the whole range and makes the run time independent of the
+    number of check points.
+*/
+void check_options_set_float64_samples(std::uint64_t count);
+
+std::uint64_t check_options_float64_samples();
+
+#endif
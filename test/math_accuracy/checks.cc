@@ -15,6 +15,90 @@ void main_check_accuracy(const std::string& check_name)
         check_log2_approx_accuracy();
         check_log2_approx_positive_finite_accuracy();
     }
+    if (check_name == "" || check_name == "exp") {
+        check_exp_accuracy();
+    }
+    if (check_name == "" || check_name == "exp2") {
+        check_exp2_accuracy();
+    }
+    if (check_name == "" || check_name == "expm1") {
+        check_expm1_accuracy();
+    }
+    if (check_name == "" || check_name == "frexp") {
+        check_frexp_accuracy();
+    }
+    if (check_name == "" || check_name == "ldexp") {
+        check_ldexp_accuracy();
+    }
+    if (check_name == "" || check_name == "ilogb") {
+        check_ilogb_accuracy();
+    }
+    if (check_name == "" || check_name == "log") {
+        check_log_accuracy();
+    }
+    if (check_name == "" || check_name == "log2") {
+        check_log2_accuracy();
+    }
+    if (check_name == "" || check_name == "log10") {
+        check_log10_accuracy();
+    }
+    if (check_name == "" || check_name == "log1p") {
+        check_log1p_accuracy();
+    }
+    if (check_name == "" || check_name == "sin") {
+        check_sin_accuracy();
+    }
+    if (check_name == "" || check_name == "cos") {
+        check_cos_accuracy();
+    }
+    if (check_name == "" || check_name == "sincos") {
+        check_sincos_accuracy();
+    }
+    if (check_name == "" || check_name == "tan") {
+        check_tan_accuracy();
+    }
+    if (check_name == "" || check_name == "trig_bounded") {
+        check_trig_bounded_accuracy();
+    }
+    if (check_name == "" || check_name == "atan") {
+        check_atan_accuracy();
+    }
+    if (check_name == "" || check_name == "atan2") {
+        check_atan2_accuracy();
+    }
+    if (check_name == "" || check_name == "asin") {
+        check_asin_accuracy();
+    }
+    if (check_name == "" || check_name == "acos") {
+        check_acos_accuracy();
+    }
+    if (check_name == "" || check_name == "pow") {
+        check_pow_accuracy();
+    }
+    if (check_name == "" || check_name == "cbrt") {
+        check_cbrt_accuracy();
+    }
+    if (check_name == "" || check_name == "hypot") {
+        check_hypot_accuracy();
+    }
+    if (check_name == "" || check_name == "rsqrt_newton") {
+        check_rsqrt_newton_accuracy();
+    }
+    if (check_name == "" || check_name == "tanh") {
+        check_tanh_accuracy();
+    }
+    if (check_name == "" || check_name == "sigmoid") {
+        check_sigmoid_accuracy();
+    }
+    if (check_name == "" || check_name == "erf") {
+        check_erf_accuracy();
+    }
+    if (check_name == "" || check_name == "gelu") {
+        check_gelu_accuracy();
+    }
+    if (check_name == "" || check_name == "gelu_tanh") {
+        check_gelu_tanh_accuracy();
+    }
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
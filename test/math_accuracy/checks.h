@@ -16,6 +16,34 @@ namespace SIMDPP_ARCH_NAMESPACE {
 void main_check_accuracy(const std::string& check_name);
 void check_log2_approx_accuracy();
 void check_log2_approx_positive_finite_accuracy();
+void check_exp_accuracy();
+void check_exp2_accuracy();
+void check_expm1_accuracy();
+void check_frexp_accuracy();
+void check_ldexp_accuracy();
+void check_ilogb_accuracy();
+void check_log_accuracy();
+void check_log2_accuracy();
+void check_log10_accuracy();
+void check_log1p_accuracy();
+void check_sin_accuracy();
+void check_cos_accuracy();
+void check_sincos_accuracy();
+void check_tan_accuracy();
+void check_trig_bounded_accuracy();
+void check_atan_accuracy();
+void check_atan2_accuracy();
+void check_asin_accuracy();
+void check_acos_accuracy();
+void check_pow_accuracy();
+void check_cbrt_accuracy();
+void check_hypot_accuracy();
+void check_rsqrt_newton_accuracy();
+void check_tanh_accuracy();
+void check_sigmoid_accuracy();
+void check_erf_accuracy();
+void check_gelu_accuracy();
+void check_gelu_tanh_accuracy();
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 
@@ -0,0 +1,87 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/exp.h>
+#include "check_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_exp(long double x) { return std::exp(x); }
+long double ref_exp2(long double x) { return std::exp2(x); }
+long double ref_expm1(long double x) { return std::expm1(x); }
+
+const std::vector<double>& exp_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-20, 1e-8, 1e-3, 0.1, 0.34, 0.5, 0.69, 1.0, 2.0, 10.0,
+        100.0, 700.0, 709.7, 745.0
+    };
+    return points;
+}
+
+template<class Tag>
+void check_exp_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("exp" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::exp(v, tag)); }, ref_exp);
+    check_accuracy_float64("exp" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::exp(v, tag)); }, ref_exp,
+        exp_float64_points());
+}
+
+template<class Tag>
+void check_exp2_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("exp2" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::exp2(v, tag)); }, ref_exp2);
+    std::vector<double> points = exp_float64_points();
+    points.push_back(1023.5);
+    points.push_back(1074.5);
+    check_accuracy_float64("exp2" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::exp2(v, tag)); }, ref_exp2,
+        points);
+}
+
+template<class Tag>
+void check_expm1_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("expm1" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::expm1(v, tag)); }, ref_expm1);
+    std::vector<double> points = exp_float64_points();
+    points.push_back(37.0);
+    check_accuracy_float64("expm1" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::expm1(v, tag)); }, ref_expm1,
+        points);
+}
+
+} // namespace
+
+void check_exp_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_exp_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_exp2_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_exp2_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_expm1_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_expm1_accuracy_tier(suffix, tag);
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
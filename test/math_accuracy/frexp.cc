@@ -0,0 +1,140 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/frexp.h>
+#include "check_helpers.h"
+#include <climits>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+using int32v_for_float32v = simdpp::int32<simdpp::float32v::length>;
+using int32v_for_float64v = simdpp::int32<simdpp::float64v::length>;
+
+long double ref_frexp_mant(long double x)
+{
+    if (x == 0 || !std::isfinite(x)) {
+        return x;
+    }
+    int e;
+    return std::frexp(x, &e);
+}
+
+long double ref_frexp_exp(long double x)
+{
+    if (x == 0 || !std::isfinite(x)) {
+        return 0;
+    }
+    int e;
+    std::frexp(x, &e);
+    return e;
+}
+
+// INT_MAX is not representable in float32, thus infinity is mapped to 1e10
+long double ref_ilogb(long double x)
+{
+    if (std::isinf(x)) {
+        return 1e10;
+    }
+    if (x == 0 || std::isnan(x)) {
+        return INT_MIN;
+    }
+    return std::ilogb(x);
+}
+
+long double ref_ldexp_5(long double x) { return std::ldexp(x, 5); }
+long double ref_ldexp_neg140(long double x) { return std::ldexp(x, -140); }
+long double ref_ldexp_neg1070(long double x) { return std::ldexp(x, -1070); }
+long double ref_ldexp_1100(long double x) { return std::ldexp(x, 1100); }
+
+const std::vector<double>& frexp_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 5e-324, 1e-310, 2.2250738585072e-308, 1e-300, 1e-20, 0.5, 0.75,
+        1.0, 3.0, 1e20, 1e300, 1.7976931348623e308
+    };
+    return points;
+}
+
+template<class V>
+V ilogb_as_float(const V& i, const V& v)
+{
+    V inf = simdpp::make_float(std::numeric_limits<double>::infinity());
+    V big = simdpp::make_float(1e10);
+    return simdpp::blend(big, i, simdpp::cmp_eq(simdpp::abs(v), inf));
+}
+
+} // namespace
+
+void check_frexp_accuracy()
+{
+    check_accuracy_float32("frexp.mant",
+        [](const simdpp::float32v& v) {
+            int32v_for_float32v e;
+            return simdpp::float32v(simdpp::frexp(v, e));
+        }, ref_frexp_mant);
+    check_accuracy_float32("frexp.exp",
+        [](const simdpp::float32v& v) {
+            int32v_for_float32v e;
+            simdpp::frexp(v, e);
+            return simdpp::float32v(simdpp::to_float32(e));
+        }, ref_frexp_exp);
+    check_accuracy_float64("frexp.mant",
+        [](const simdpp::float64v& v) {
+            int32v_for_float64v e;
+            return simdpp::float64v(simdpp::frexp(v, e));
+        }, ref_frexp_mant, frexp_float64_points());
+    check_accuracy_float64("frexp.exp",
+        [](const simdpp::float64v& v) {
+            int32v_for_float64v e;
+            simdpp::frexp(v, e);
+            return simdpp::float64v(simdpp::to_float64(e));
+        }, ref_frexp_exp, frexp_float64_points());
+}
+
+void check_ilogb_accuracy()
+{
+    check_accuracy_float32("ilogb",
+        [](const simdpp::float32v& v) {
+            simdpp::float32v i = simdpp::to_float32(simdpp::ilogb(v));
+            return ilogb_as_float(i, v);
+        }, ref_ilogb);
+    check_accuracy_float64("ilogb",
+        [](const simdpp::float64v& v) {
+            simdpp::float64v i = simdpp::to_float64(simdpp::ilogb(v));
+            return ilogb_as_float(i, v);
+        }, ref_ilogb, frexp_float64_points());
+}
+
+void check_ldexp_accuracy()
+{
+    int32v_for_float32v n5 = simdpp::splat(5);
+    int32v_for_float32v n_neg140 = simdpp::splat(-140);
+    check_accuracy_float32("ldexp(x, 5)",
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::ldexp(v, n5)); },
+        ref_ldexp_5);
+    check_accuracy_float32("ldexp(x, -140)",
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::ldexp(v, n_neg140)); },
+        ref_ldexp_neg140);
+
+    int32v_for_float64v d5 = simdpp::splat(5);
+    int32v_for_float64v d_neg1070 = simdpp::splat(-1070);
+    int32v_for_float64v d1100 = simdpp::splat(1100);
+    check_accuracy_float64("ldexp(x, 5)",
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::ldexp(v, d5)); },
+        ref_ldexp_5, frexp_float64_points());
+    check_accuracy_float64("ldexp(x, -1070)",
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::ldexp(v, d_neg1070)); },
+        ref_ldexp_neg1070, frexp_float64_points());
+    check_accuracy_float64("ldexp(x, 1100)",
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::ldexp(v, d1100)); },
+        ref_ldexp_1100, frexp_float64_points());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,159 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/inverse_trig.h>
+#include "check_helpers.h"
+#include <iostream>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_atan(long double x) { return std::atan(x); }
+long double ref_asin(long double x) { return std::asin(x); }
+long double ref_acos(long double x) { return std::acos(x); }
+long double ref_atan2_y_neg1(long double y) { return std::atan2(y, -1.0L); }
+long double ref_atan2_1_x(long double x) { return std::atan2(1.0L, x); }
+
+const std::vector<double>& atan_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 0.4375, 0.5, 0.6875, 0.99, 1.0, 1.5, 2.4375,
+        10.0, 1e10, 1e300
+    };
+    return points;
+}
+
+const std::vector<double>& asin_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 0.4999999, 0.5, 0.7, 0.975, 0.9999999
+    };
+    return points;
+}
+
+/*  The accuracy checker does not distinguish the sign of zero, thus the
+    combinations of zero, infinite and NaN arguments are compared against
+    std::atan2 directly.
+*/
+template<class V, class Tag>
+void check_atan2_special_values(const std::string& name, Tag tag)
+{
+    using T = typename V::element_type;
+    const T inf = std::numeric_limits<T>::infinity();
+    const T values[] = { T(0), -T(0), T(1), -T(1), inf, -inf,
+                         std::numeric_limits<T>::quiet_NaN() };
+
+    unsigned mismatches = 0;
+    for (T y : values) {
+        for (T x : values) {
+            V vy = simdpp::splat(y);
+            V vx = simdpp::splat(x);
+            T result = simdpp::extract<0>(V(simdpp::atan2(vy, vx, tag)));
+            T expected = std::atan2(y, x);
+            bool same_nan = std::isnan(result) && std::isnan(expected);
+            if (!same_nan && (ulp_distance(result, expected) > 1 ||
+                              std::signbit(result) != std::signbit(expected))) {
+                mismatches++;
+            }
+        }
+    }
+    std::cout << "Check " << name << " special values: "
+              << mismatches << " mismatches\n";
+    if (mismatches > 0) {
+        accuracy_table_add_failure(name, std::to_string(mismatches) +
+                                   " special values differ from std::atan2");
+    }
+}
+
+template<class Tag>
+void check_atan_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("atan" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::atan(v, tag)); }, ref_atan);
+    check_accuracy_float64("atan" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::atan(v, tag)); }, ref_atan,
+        atan_float64_points());
+}
+
+template<class Tag>
+void check_atan2_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    simdpp::float32v one32 = simdpp::splat(1.0f);
+    simdpp::float64v one64 = simdpp::splat(1.0);
+    check_accuracy_float32("atan2(y, -1)" + suffix,
+        [&](const simdpp::float32v& v) {
+            return simdpp::float32v(simdpp::atan2(v, simdpp::float32v(neg(one32)), tag));
+        }, ref_atan2_y_neg1);
+    check_accuracy_float32("atan2(1, x)" + suffix,
+        [&](const simdpp::float32v& v) {
+            return simdpp::float32v(simdpp::atan2(one32, v, tag));
+        }, ref_atan2_1_x);
+    check_accuracy_float64("atan2(y, -1)" + suffix,
+        [&](const simdpp::float64v& v) {
+            return simdpp::float64v(simdpp::atan2(v, simdpp::float64v(neg(one64)), tag));
+        }, ref_atan2_y_neg1, atan_float64_points());
+    check_accuracy_float64("atan2(1, x)" + suffix,
+        [&](const simdpp::float64v& v) {
+            return simdpp::float64v(simdpp::atan2(one64, v, tag));
+        }, ref_atan2_1_x, atan_float64_points());
+    check_atan2_special_values<simdpp::float32v>("atan2" + suffix + "(float32)", tag);
+    check_atan2_special_values<simdpp::float64v>("atan2" + suffix + "(float64)", tag);
+}
+
+template<class Tag>
+void check_asin_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("asin" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::asin(v, tag)); }, ref_asin);
+    check_accuracy_float64("asin" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::asin(v, tag)); }, ref_asin,
+        asin_float64_points());
+}
+
+template<class Tag>
+void check_acos_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("acos" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::acos(v, tag)); }, ref_acos);
+    check_accuracy_float64("acos" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::acos(v, tag)); }, ref_acos,
+        asin_float64_points());
+}
+
+} // namespace
+
+void check_atan_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_atan_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_atan2_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_atan2_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_asin_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_asin_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_acos_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_acos_accuracy_tier(suffix, tag);
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,100 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/log.h>
+#include "check_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_log(long double x) { return std::log(x); }
+long double ref_log2(long double x) { return std::log2(x); }
+long double ref_log10(long double x) { return std::log10(x); }
+long double ref_log1p(long double x) { return std::log1p(x); }
+
+const std::vector<double>& log_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-310, 1e-300, 1e-20, 1e-8, 1e-3, 0.29, 0.41, 0.5, 0.7071, 0.99,
+        1.0, 1.4142, 2.0, 10.0, 1e100, 1e300
+    };
+    return points;
+}
+
+template<class Tag>
+void check_log_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("log" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::log(v, tag)); }, ref_log);
+    check_accuracy_float64("log" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::log(v, tag)); }, ref_log,
+        log_float64_points());
+}
+
+template<class Tag>
+void check_log2_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("log2" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::log2(v, tag)); }, ref_log2);
+    check_accuracy_float64("log2" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::log2(v, tag)); }, ref_log2,
+        log_float64_points());
+}
+
+template<class Tag>
+void check_log10_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("log10" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::log10(v, tag)); }, ref_log10);
+    check_accuracy_float64("log10" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::log10(v, tag)); }, ref_log10,
+        log_float64_points());
+}
+
+template<class Tag>
+void check_log1p_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("log1p" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::log1p(v, tag)); }, ref_log1p);
+    check_accuracy_float64("log1p" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::log1p(v, tag)); }, ref_log1p,
+        log_float64_points());
+}
+
+} // namespace
+
+void check_log_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_log_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_log2_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_log2_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_log10_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_log10_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_log1p_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_log1p_accuracy_tier(suffix, tag);
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -7,21 +7,35 @@
 
 #include <simdpp/simd.h>
 #include <simdpp/math/log2_approx.h>
-#include "accuracy_checker.h"
+#include "check_helpers.h"
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
+namespace {
+
+long double ref_log2(long double x) { return std::log2(x); }
+
+// log2_approx() does not support subnormal arguments
+const std::vector<double>& log2_approx_float64_points()
+{
+    static std::vector<double> points = {
+        std::numeric_limits<double>::min(), 1e-300, 1e-10, 0.5, 0.75, 1.0, 1.5,
+        3.0, 1e10, 1e300
+    };
+    return points;
+}
+
+} // namespace
+
 void check_log2_approx_positive_finite_accuracy()
 {
     auto expected_func = [](const float* src, float* dst, std::size_t size) {
-        #pragma omp parallel for
         for (std::size_t i = 0; i < size; ++i) {
             *dst++ = std::log2(*src++);
         }
     };
 
     auto check_func = [](const float* src, float* dst, std::size_t size) {
-        #pragma omp parallel for
         for (std::size_t i = 0; i < size; i += simdpp::float32v::length) {
             simdpp::float32v v = simdpp::load(src);
             v = simdpp::log2_approx_positive_finite(v);
@@ -37,6 +51,12 @@ void check_log2_approx_positive_finite_accuracy()
     checker.set_bounds({{std::numeric_limits<float>::min(), std::numeric_limits<float>::max()}});
     checker.run_check(expected_func, check_func);
     checker.describe("log2_approx_positive_finite(float32)");
+
+    check_accuracy_float64("log2_approx_positive_finite",
+        [](const simdpp::float64v& v) {
+            return simdpp::float64v(simdpp::log2_approx_positive_finite(v));
+        },
+        ref_log2, log2_approx_float64_points(), false);
 }
 
 void check_log2_approx_accuracy()
@@ -62,6 +82,10 @@ void check_log2_approx_accuracy()
     checker.set_bounds({{std::numeric_limits<float>::min(), std::numeric_limits<float>::max()}});
     checker.run_check(expected_func, check_func);
     checker.describe("log2_approx(float32)");
+
+    check_accuracy_float64("log2_approx",
+        [](const simdpp::float64v& v) { return simdpp::float64v(simdpp::log2_approx(v)); },
+        ref_log2, log2_approx_float64_points());
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
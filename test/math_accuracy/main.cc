@@ -5,17 +5,23 @@
             http://www.boost.org/LICENSE_1_0.txt)
 */
 
+#include "accuracy_table.h"
+#include "check_options.h"
 #include "checks.h"
 #include "../utils/test_arch.h"
 #include "../utils/test_helpers.h"
 #include <simdpp/simd.h>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
 
 void invoke_check_run_function(const simdpp::detail::FnVersion& fn, const std::string& check_name)
 {
     reinterpret_cast<void(*)(const std::string&)>(fn.fun_ptr)(check_name);
 }
 
-inline void parse_args(int argc, char* argv[], std::string& name, bool& force_arch)
+inline void parse_args(int argc, char* argv[], std::string& name, bool& force_arch,
+                       std::string& table_path)
 {
     force_arch = false;
     for (int i = 1; i < argc; ++i) {
@@ -28,14 +34,27 @@ inline void parse_args(int argc, char* argv[], std::string& name, bool& force_ar
                 i++;
             }
         }
+        if (std::strcmp(argv[i], "--ulp_table") == 0) {
+            if (i < argc - 1) {
+                table_path = argv[i + 1];
+                i++;
+            }
+        }
+        if (std::strcmp(argv[i], "--float64_samples") == 0) {
+            if (i < argc - 1) {
+                check_options_set_float64_samples(std::strtoull(argv[i + 1], nullptr, 10));
+                i++;
+            }
+        }
     }
 }
 
 int main(int argc, char* argv[])
 {
     std::string check_name;
+    std::string table_path;
     bool force_arch = false;
-    parse_args(argc, argv, check_name, force_arch);
+    parse_args(argc, argv, check_name, force_arch, table_path);
 
     simdpp::Arch current_arch;
     if (force_arch) {
@@ -65,6 +84,27 @@ int main(int argc, char* argv[])
         }
         std::cerr << "Testing: " << it->arch_name << std::endl;
 
+        accuracy_table_set_arch(it->arch_name);
         invoke_check_run_function(*it, check_name);
     }
+
+    // The table is printed to the standard output unless --ulp_table is given
+    if (table_path.empty()) {
+        std::cout << "\n";
+        accuracy_table_write(std::cout);
+    } else {
+        std::ofstream table_file(table_path);
+        if (!table_file) {
+            std::cerr << "FATAL: could not open " << table_path << "\n";
+            return EXIT_FAILURE;
+        }
+        accuracy_table_write(table_file);
+    }
+
+    unsigned num_failures = accuracy_table_num_failures();
+    if (num_failures > 0) {
+        std::cerr << num_failures << " checks exceeded the documented error bounds\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
 }
@@ -0,0 +1,181 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/pow.h>
+#include <simdpp/math/rsqrt_newton.h>
+#include "check_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_pow_x_2_5(long double x) { return std::pow(x, 2.5L); }
+long double ref_pow_x_neg3(long double x) { return std::pow(x, -3.0L); }
+long double ref_pow_1_5_y(long double y) { return std::pow(1.5L, y); }
+long double ref_cbrt(long double x) { return std::cbrt(x); }
+long double ref_hypot_x_1(long double x) { return std::hypot(x, 1.0L); }
+long double ref_hypot_x_x(long double x) { return std::hypot(x, x * 0.75L); }
+long double ref_rsqrt(long double x) { return 1.0L / std::sqrt(x); }
+long double ref_sqrt(long double x) { return std::sqrt(x); }
+
+const std::vector<double>& pow_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-100, 1e-8, 0.1, 0.5, 0.9999, 1.0, 1.0001, 2.0, 100.0,
+        1e100, 1e200
+    };
+    return points;
+}
+
+const std::vector<double>& pow_y_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 1.0, 10.0, 100.0, 1000.0, 1700.0, 1840.0
+    };
+    return points;
+}
+
+const std::vector<double>& cbrt_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-310, 1e-300, 1e-8, 0.1, 1.0, 7.9, 1e10, 1e300
+    };
+    return points;
+}
+
+const std::vector<double>& hypot_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-310, 1e-200, 1e-8, 0.1, 1.0, 10.0, 1e8, 1e200, 1e307
+    };
+    return points;
+}
+
+// The results of rsqrt_newton() for zero and subnormal arguments are unspecified
+const std::vector<double>& rsqrt_newton_float64_points()
+{
+    static std::vector<double> points = {
+        std::numeric_limits<double>::min(), 1e-200, 1e-8, 0.1, 1.0, 10.0, 1e8,
+        1e200, 1e307
+    };
+    return points;
+}
+
+template<class Tag>
+void check_pow_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    simdpp::float32v c2_5 = simdpp::splat(2.5f);
+    simdpp::float32v cneg3 = simdpp::splat(-3.0f);
+    simdpp::float32v c1_5 = simdpp::splat(1.5f);
+    check_accuracy_float32(std::string("pow(x, 2.5)") + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::pow(v, c2_5, tag)); },
+        ref_pow_x_2_5);
+    check_accuracy_float32(std::string("pow(x, -3)") + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::pow(v, cneg3, tag)); },
+        ref_pow_x_neg3);
+    check_accuracy_float32(std::string("pow(1.5, y)") + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::pow(c1_5, v, tag)); },
+        ref_pow_1_5_y);
+
+    simdpp::float64v d2_5 = simdpp::splat(2.5);
+    simdpp::float64v dneg3 = simdpp::splat(-3.0);
+    simdpp::float64v d1_5 = simdpp::splat(1.5);
+    check_accuracy_float64(std::string("pow(x, 2.5)") + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::pow(v, d2_5, tag)); },
+        ref_pow_x_2_5, pow_float64_points());
+    check_accuracy_float64(std::string("pow(x, -3)") + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::pow(v, dneg3, tag)); },
+        ref_pow_x_neg3, pow_float64_points());
+    check_accuracy_float64(std::string("pow(1.5, y)") + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::pow(d1_5, v, tag)); },
+        ref_pow_1_5_y, pow_y_float64_points());
+}
+
+template<class Tag>
+void check_cbrt_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("cbrt" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::cbrt(v, tag)); }, ref_cbrt);
+    check_accuracy_float64("cbrt" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::cbrt(v, tag)); }, ref_cbrt,
+        cbrt_float64_points());
+}
+
+template<class Tag>
+void check_hypot_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    simdpp::float32v one32 = simdpp::splat(1.0f);
+    simdpp::float32v f0_75 = simdpp::splat(0.75f);
+    check_accuracy_float32(std::string("hypot(x, 1)") + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::hypot(v, one32, tag)); },
+        ref_hypot_x_1);
+    check_accuracy_float32(std::string("hypot(x, 0.75x)") + suffix,
+        [&](const simdpp::float32v& v) {
+            return simdpp::float32v(simdpp::hypot(v, simdpp::float32v(mul(v, f0_75)), tag));
+        }, ref_hypot_x_x);
+
+    simdpp::float64v one64 = simdpp::splat(1.0);
+    simdpp::float64v d0_75 = simdpp::splat(0.75);
+    check_accuracy_float64(std::string("hypot(x, 1)") + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::hypot(v, one64, tag)); },
+        ref_hypot_x_1, hypot_float64_points());
+    check_accuracy_float64(std::string("hypot(x, 0.75x)") + suffix,
+        [&](const simdpp::float64v& v) {
+            return simdpp::float64v(simdpp::hypot(v, simdpp::float64v(mul(v, d0_75)), tag));
+        }, ref_hypot_x_x, hypot_float64_points());
+}
+
+} // namespace
+
+void check_pow_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_pow_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_cbrt_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_cbrt_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_hypot_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_hypot_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_rsqrt_newton_accuracy()
+{
+    const std::vector<std::pair<float, float>> normal_bounds = {
+        {std::numeric_limits<float>::min(), std::numeric_limits<float>::infinity()}
+    };
+    check_accuracy_float32("rsqrt_newton<1>",
+        [](const simdpp::float32v& v) { return simdpp::float32v(simdpp::rsqrt_newton<1>(v)); },
+        ref_rsqrt, normal_bounds);
+    check_accuracy_float32("rsqrt_newton<2>",
+        [](const simdpp::float32v& v) { return simdpp::float32v(simdpp::rsqrt_newton<2>(v)); },
+        ref_rsqrt, normal_bounds);
+    check_accuracy_float32("sqrt_newton<2>",
+        [](const simdpp::float32v& v) { return simdpp::float32v(simdpp::sqrt_newton<2>(v)); },
+        ref_sqrt, normal_bounds);
+    check_accuracy_float64("rsqrt_newton<3>",
+        [](const simdpp::float64v& v) { return simdpp::float64v(simdpp::rsqrt_newton<3>(v)); },
+        ref_rsqrt, rsqrt_newton_float64_points(), false);
+    check_accuracy_float64("rsqrt_newton<4>",
+        [](const simdpp::float64v& v) { return simdpp::float64v(simdpp::rsqrt_newton<4>(v)); },
+        ref_rsqrt, rsqrt_newton_float64_points(), false);
+    check_accuracy_float64("sqrt_newton<4>",
+        [](const simdpp::float64v& v) { return simdpp::float64v(simdpp::sqrt_newton<4>(v)); },
+        ref_sqrt, rsqrt_newton_float64_points(), false);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,153 @@
+/*  Copyright (C) 2024  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/math/trig.h>
+#include "check_helpers.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+namespace {
+
+long double ref_sin(long double x) { return std::sin(x); }
+long double ref_cos(long double x) { return std::cos(x); }
+long double ref_tan(long double x) { return std::tan(x); }
+
+// Includes points around the boundary of the Cody-Waite reduction and points
+// that need the Payne-Hanek reduction
+const std::vector<double>& trig_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 0.7853981, 1.5707963, 3.1415926, 100.0,
+        -1000.0, 1048570.0, -1048580.0, 1e10, 1e22, -1e100, 1e300
+    };
+    return points;
+}
+
+const std::vector<double>& trig_bounded_float64_points()
+{
+    static std::vector<double> points = {
+        0.0, 1e-300, 1e-8, 0.1, 0.7853981, 1.5707963, 3.1415926, 100.0,
+        -1000.0, 1048570.0
+    };
+    return points;
+}
+
+template<class Tag>
+void check_sin_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("sin" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::sin(v, tag)); }, ref_sin);
+    check_accuracy_float64("sin" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::sin(v, tag)); }, ref_sin,
+        trig_float64_points());
+}
+
+template<class Tag>
+void check_cos_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("cos" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::cos(v, tag)); }, ref_cos);
+    check_accuracy_float64("cos" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::cos(v, tag)); }, ref_cos,
+        trig_float64_points());
+}
+
+template<class Tag>
+void check_sincos_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("sincos.sin" + suffix,
+        [&](const simdpp::float32v& v) {
+            simdpp::float32v s, c;
+            simdpp::sincos(v, s, c, tag);
+            return s;
+        }, ref_sin);
+    check_accuracy_float32("sincos.cos" + suffix,
+        [&](const simdpp::float32v& v) {
+            simdpp::float32v s, c;
+            simdpp::sincos(v, s, c, tag);
+            return c;
+        }, ref_cos);
+    check_accuracy_float64("sincos.sin" + suffix,
+        [&](const simdpp::float64v& v) {
+            simdpp::float64v s, c;
+            simdpp::sincos(v, s, c, tag);
+            return s;
+        }, ref_sin, trig_float64_points());
+    check_accuracy_float64("sincos.cos" + suffix,
+        [&](const simdpp::float64v& v) {
+            simdpp::float64v s, c;
+            simdpp::sincos(v, s, c, tag);
+            return c;
+        }, ref_cos, trig_float64_points());
+}
+
+template<class Tag>
+void check_tan_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float32("tan" + suffix,
+        [&](const simdpp::float32v& v) { return simdpp::float32v(simdpp::tan(v, tag)); }, ref_tan);
+    check_accuracy_float64("tan" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::tan(v, tag)); }, ref_tan,
+        trig_float64_points());
+}
+
+/*  Only the supported range is checked: the results outside it are
+    unspecified.
+*/
+template<class Tag>
+void check_trig_bounded_accuracy_tier(const std::string& suffix, Tag tag)
+{
+    check_accuracy_float64("sin_bounded" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::sin_bounded(v, tag)); },
+        ref_sin, trig_bounded_float64_points());
+    check_accuracy_float64("cos_bounded" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::cos_bounded(v, tag)); },
+        ref_cos, trig_bounded_float64_points());
+    check_accuracy_float64("tan_bounded" + suffix,
+        [&](const simdpp::float64v& v) { return simdpp::float64v(simdpp::tan_bounded(v, tag)); },
+        ref_tan, trig_bounded_float64_points());
+}
+
+} // namespace
+
+void check_sin_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_sin_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_cos_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_cos_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_sincos_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_sincos_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_tan_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_tan_accuracy_tier(suffix, tag);
+    });
+}
+
+void check_trig_bounded_accuracy()
+{
+    for_each_accuracy_tier([](const std::string& suffix, auto tag) {
+        check_trig_bounded_accuracy_tier(suffix, tag);
+    });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE